@@ -0,0 +1,536 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/*
+ * Event storm benchmark.
+ *
+ * Runs the real lan_manager (its main() is renamed lan_manager_main() at
+ * build time) against lanmgr_fake and replays a script of events. Script
+ * lines, '#' starts a comment and "-" stands for an empty value:
+ *
+ *   syscfg <name> <value>               syscfg_get result
+ *   preset <name> <value>               sysevent value, not notified
+ *   wait <ms>
+ *   event <name> <value> [expect <set>]
+ *   storm <count> <rate|-> <name> <value> [expect <set>]
+ *   drop                                hang up the notification session
+ *
+ * A storm sends count events at rate events/s (0 or "-" use -r, where 0 is
+ * unpaced); "%d" in its value is replaced by the event index. "expect"
+ * names the outbound set the event should lead to: the notification to
+ * action latency is the time until the first such set after the event.
+ *
+ * The outbound set sequence is printed in issue order and, with -c, compared
+ * line by line with a file. Every run starts from an empty persisted state
+ * and journal like a boot does, unless -k keeps the ones left by the
+ * previous run. lan_manager_replay -s turns a journal captured on a device
+ * into a script, so a field bring-up can be replayed here.
+ */
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lanmgr_executor.h"
+#include "lanmgr_journal.h"
+#include "lanmgr_state.h"
+#include "lanmgr_sysevent.h"
+#include "lanmgr_fake.h"
+
+#define BENCH_MAX_LINE        512
+#define BENCH_DEFAULT_SETTLE  300       /* ms without any activity before stopping */
+
+typedef struct
+{
+    char      name[64];
+    uint64_t  sent_us;
+    int       matched;
+} BenchExpect;
+
+typedef struct
+{
+    uint32_t  *v;
+    size_t     n;
+    size_t     max;
+} BenchSamples;
+
+int lan_manager_main(int argc, char *argv[]);
+
+static const char *script_path = NULL;
+static const char *expected_path = NULL;
+static unsigned int default_rate = 0;
+static unsigned int settle_ms = BENCH_DEFAULT_SETTLE;
+static int verbose = 0;
+static int quiet = 0;
+static int keep_state = 0;
+
+static pthread_mutex_t bench_lock = PTHREAD_MUTEX_INITIALIZER;
+static char **actions = NULL;           /* outbound sequence */
+static size_t num_actions = 0;
+static size_t max_actions = 0;
+static uint64_t last_activity_us = 0;    /* last event sent or action seen */
+static BenchExpect *expects = NULL;
+static size_t num_expects = 0;
+static size_t max_expects = 0;
+static size_t first_pending = 0;
+static BenchSamples recv_lat;
+static BenchSamples action_lat;
+static unsigned int events_sent = 0;
+static unsigned int events_recv = 0;
+static uint64_t first_sent_us = 0;
+static uint64_t drained_us = 0;
+static int script_failed = 0;
+static FILE *script = NULL;
+static char script_line[BENCH_MAX_LINE];
+static int script_lineno = 0;
+static int script_pending = 0;          /* script_line read but not run yet */
+static volatile int lnm_exited = 0;
+
+static void *Bench_Grow(void *p, size_t *max, size_t elem)
+{
+    size_t n = *max ? *max * 2 : 256;
+    void *q = realloc(p, n * elem);
+
+    if (q == NULL)
+    {
+        fprintf(stderr, "lan_manager_bench: out of memory\n");
+        exit(2);
+    }
+    *max = n;
+    return q;
+}
+
+static void Bench_Sample(BenchSamples *s, uint64_t us)
+{
+    if (s->n == s->max)
+    {
+        s->v = Bench_Grow(s->v, &s->max, sizeof(*s->v));
+    }
+    s->v[s->n++] = us > UINT32_MAX ? UINT32_MAX : (uint32_t)us;
+}
+
+static void Bench_Action(const char *op, const char *name, const char *val, uint64_t now_us)
+{
+    char line[BENCH_MAX_LINE];
+    size_t i;
+
+    if (strcmp(op, "set") == 0)
+    {
+        snprintf(line, sizeof(line), "set %s=%s", name, val);
+    }
+    else
+    {
+        snprintf(line, sizeof(line), "%s %s", op, name);
+    }
+    pthread_mutex_lock(&bench_lock);
+    if (num_actions == max_actions)
+    {
+        actions = Bench_Grow(actions, &max_actions, sizeof(*actions));
+    }
+    actions[num_actions++] = strdup(line);
+    last_activity_us = now_us;
+    /* one action answers every earlier event waiting for it */
+    for (i = first_pending; i < num_expects; i++)
+    {
+        BenchExpect *e = &expects[i];
+
+        if (!e->matched && e->sent_us <= now_us && strcmp(e->name, name) == 0)
+        {
+            e->matched = 1;
+            Bench_Sample(&action_lat, now_us - e->sent_us);
+        }
+    }
+    while (first_pending < num_expects && expects[first_pending].matched)
+    {
+        first_pending++;
+    }
+    pthread_mutex_unlock(&bench_lock);
+}
+
+static void Bench_Recv(unsigned int tag, uint64_t sent_us, uint64_t now_us)
+{
+    pthread_mutex_lock(&bench_lock);
+    events_recv++;
+    Bench_Sample(&recv_lat, now_us - sent_us);
+    pthread_mutex_unlock(&bench_lock);
+}
+
+static void Bench_SleepUntil(uint64_t us)
+{
+    struct timespec ts;
+
+    ts.tv_sec = us / 1000000;
+    ts.tv_nsec = (us % 1000000) * 1000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+    }
+}
+
+static void Bench_Send(const char *name, const char *val, const char *expect)
+{
+    unsigned int tag;
+    uint64_t now;
+
+    pthread_mutex_lock(&bench_lock);
+    now = LNM_FakeMonotonicUs();
+    if (first_sent_us == 0)
+    {
+        first_sent_us = now;
+    }
+    last_activity_us = now;
+    if (expect != NULL)
+    {
+        if (num_expects == max_expects)
+        {
+            expects = Bench_Grow(expects, &max_expects, sizeof(*expects));
+        }
+        snprintf(expects[num_expects].name, sizeof(expects[0].name), "%s", expect);
+        expects[num_expects].sent_us = now;
+        expects[num_expects].matched = 0;
+        num_expects++;
+    }
+    tag = ++events_sent;
+    pthread_mutex_unlock(&bench_lock);
+    if (LNM_FakeSyseventNotify(name, val, tag) == 0)
+    {
+        fprintf(stderr, "lan_manager_bench: nobody subscribed to %s\n", name);
+        script_failed = 1;
+    }
+}
+
+/* Replace the first "%d" in pattern by index. */
+static void Bench_Expand(char *out, size_t len, const char *pattern, unsigned int index)
+{
+    const char *p = strstr(pattern, "%d");
+
+    if (p == NULL)
+    {
+        snprintf(out, len, "%s", pattern);
+        return;
+    }
+    snprintf(out, len, "%.*s%u%s", (int)(p - pattern), pattern, index, p + 2);
+}
+
+static int Bench_RunLine(char *line, int lineno)
+{
+    char *tok[8];
+    const char *expect = NULL;
+    int n = 0, i;
+    char *save = NULL, *t;
+
+    for (t = strtok_r(line, " \t\r\n", &save); t != NULL && n < 8; t = strtok_r(NULL, " \t\r\n", &save))
+    {
+        if (t[0] == '#')
+        {
+            break;
+        }
+        tok[n++] = strcmp(t, "-") == 0 ? "" : t;
+    }
+    if (n == 0)
+    {
+        return 0;
+    }
+    if (n >= 2 && strcmp(tok[n - 2], "expect") == 0)
+    {
+        expect = tok[n - 1];
+        n -= 2;
+    }
+    if (strcmp(tok[0], "syscfg") == 0 && n == 3)
+    {
+        LNM_FakeSyscfgSet(tok[1], tok[2]);
+    }
+    else if (strcmp(tok[0], "preset") == 0 && n == 3)
+    {
+        LNM_FakeSyseventPreset(tok[1], tok[2]);
+    }
+    else if (strcmp(tok[0], "drop") == 0 && n == 1)
+    {
+        LNM_FakeSyseventDrop();
+    }
+    else if (strcmp(tok[0], "wait") == 0 && n == 2)
+    {
+        usleep((useconds_t)strtoul(tok[1], NULL, 10) * 1000);
+    }
+    else if (strcmp(tok[0], "event") == 0 && n == 3)
+    {
+        Bench_Send(tok[1], tok[2], expect);
+    }
+    else if (strcmp(tok[0], "storm") == 0 && n == 5)
+    {
+        unsigned int count = (unsigned int)strtoul(tok[1], NULL, 10);
+        unsigned int rate = (unsigned int)strtoul(tok[2], NULL, 10);
+        uint64_t start = LNM_FakeMonotonicUs();
+        char val[256];
+
+        if (rate == 0)
+        {
+            rate = default_rate;
+        }
+        for (i = 0; i < (int)count; i++)
+        {
+            if (rate != 0)
+            {
+                Bench_SleepUntil(start + (uint64_t)i * 1000000 / rate);
+            }
+            Bench_Expand(val, sizeof(val), tok[4], (unsigned int)i);
+            Bench_Send(tok[3], val, expect);
+        }
+    }
+    else
+    {
+        fprintf(stderr, "%s:%d: bad script line\n", script_path, lineno);
+        return -1;
+    }
+    return 0;
+}
+
+static int Bench_Idle(void)
+{
+    LNM_ExecutorStats s;
+    uint64_t last;
+    int received;
+
+    LNM_ExecutorGetStats(&s);
+    pthread_mutex_lock(&bench_lock);
+    last = last_activity_us;
+    received = events_recv == events_sent;
+    pthread_mutex_unlock(&bench_lock);
+    return received && s.depth == 0 && LNM_FakeMonotonicUs() - last >= (uint64_t)settle_ms * 1000;
+}
+
+/* Apply the leading syscfg and preset lines before lan_manager starts, as
+ * the values a booting device finds. Stops at the first other line. */
+static int Bench_Setup(void)
+{
+    char word[16];
+
+    while (fgets(script_line, sizeof(script_line), script) != NULL)
+    {
+        script_lineno++;
+        if (sscanf(script_line, "%15s", word) != 1 || word[0] == '#')
+        {
+            continue;
+        }
+        if (strcmp(word, "syscfg") != 0 && strcmp(word, "preset") != 0)
+        {
+            script_pending = 1;
+            return 0;
+        }
+        if (Bench_RunLine(script_line, script_lineno) != 0)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void *Bench_Driver(void *arg)
+{
+    /* notifications are only delivered to registered sessions */
+    while (!LNM_SyseventConnected())
+    {
+        if (lnm_exited)
+        {
+            return NULL;
+        }
+        usleep(1000);
+    }
+    while (script_pending || fgets(script_line, sizeof(script_line), script) != NULL)
+    {
+        if (!script_pending)
+        {
+            script_lineno++;
+        }
+        script_pending = 0;
+        if (Bench_RunLine(script_line, script_lineno) != 0 || script_failed)
+        {
+            script_failed = 1;
+            break;
+        }
+    }
+    while (!script_failed && !Bench_Idle())
+    {
+        usleep(1000);
+    }
+    drained_us = LNM_FakeMonotonicUs() - settle_ms * 1000;
+    kill(getpid(), SIGTERM);
+    return NULL;
+}
+
+static int Bench_Compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static void Bench_Percentiles(const char *what, BenchSamples *s)
+{
+    if (s->n == 0)
+    {
+        printf("%-16s n=0\n", what);
+        return;
+    }
+    qsort(s->v, s->n, sizeof(*s->v), Bench_Compare);
+    printf("%-16s n=%zu p50=%u p90=%u p99=%u max=%u us\n", what, s->n,
+           s->v[s->n * 50 / 100], s->v[s->n * 90 / 100], s->v[s->n * 99 / 100], s->v[s->n - 1]);
+}
+
+static int Bench_Check(void)
+{
+    char line[BENCH_MAX_LINE];
+    FILE *f = fopen(expected_path, "r");
+    size_t i = 0;
+    int rc = 0;
+
+    if (f == NULL)
+    {
+        fprintf(stderr, "lan_manager_bench: cannot open %s\n", expected_path);
+        return 1;
+    }
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0' || line[0] == '#')
+        {
+            continue;
+        }
+        if (i >= num_actions || strcmp(line, actions[i]) != 0)
+        {
+            fprintf(stderr, "action %zu: expected \"%s\", got \"%s\"\n", i + 1, line,
+                    i < num_actions ? actions[i] : "(none)");
+            rc = 1;
+            break;
+        }
+        i++;
+    }
+    if (rc == 0 && i != num_actions)
+    {
+        fprintf(stderr, "action %zu: unexpected \"%s\"\n", i + 1, actions[i]);
+        rc = 1;
+    }
+    fclose(f);
+    return rc;
+}
+
+static void Bench_Report(void)
+{
+    LNM_ExecutorStats s;
+    uint64_t elapsed = first_sent_us != 0 && drained_us > first_sent_us ? drained_us - first_sent_us : 0;
+    size_t i, unmatched = 0;
+
+    if (!quiet)
+    {
+        printf("outbound actions:\n");
+        for (i = 0; i < num_actions; i++)
+        {
+            printf("  %s\n", actions[i]);
+        }
+    }
+    for (i = 0; i < num_expects; i++)
+    {
+        unmatched += !expects[i].matched;
+    }
+    LNM_ExecutorGetStats(&s);
+    printf("events           sent=%u received=%u handled in %llu.%03llu ms, %.0f events/s\n",
+           events_sent, events_recv, (unsigned long long)(elapsed / 1000),
+           (unsigned long long)(elapsed % 1000), elapsed ? events_sent * 1e6 / elapsed : 0.0);
+    Bench_Percentiles("receive latency", &recv_lat);
+    Bench_Percentiles("action latency", &action_lat);
+    if (unmatched != 0)
+    {
+        printf("%-16s %zu event(s) never saw their expected action\n", "", unmatched);
+    }
+    printf("executor         max_depth=%u stalls=%llu max_wait=%u us max_run=%u us\n",
+           s.max_depth, (unsigned long long)s.stalls, s.max_wait_us, s.max_run_us);
+}
+
+static void Bench_Usage(void)
+{
+    fprintf(stderr, "usage: lan_manager_bench [-v] [-q] [-k] [-r rate] [-s settle_ms] [-c expected] script\n");
+}
+
+int main(int argc, char *argv[])
+{
+    char *lnm_argv[] = { "lan_manager", NULL };
+    pthread_t driver;
+    sigset_t mask;
+    int opt, rc;
+
+    while ((opt = getopt(argc, argv, "vqkr:s:c:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'v': verbose = 1; break;
+        case 'q': quiet = 1; break;
+        case 'k': keep_state = 1; break;
+        case 'r': default_rate = (unsigned int)strtoul(optarg, NULL, 10); break;
+        case 's': settle_ms = (unsigned int)strtoul(optarg, NULL, 10); break;
+        case 'c': expected_path = optarg; break;
+        default: Bench_Usage(); return 2;
+        }
+    }
+    if (optind != argc - 1)
+    {
+        Bench_Usage();
+        return 2;
+    }
+    script_path = argv[optind];
+    if (!keep_state)
+    {
+        unlink(LNM_STATE_FILE);
+        unlink(LNM_JOURNAL_FILE);
+    }
+    LNM_FakeInit(verbose, Bench_Action, Bench_Recv);
+    script = fopen(script_path, "r");
+    if (script == NULL)
+    {
+        fprintf(stderr, "lan_manager_bench: cannot open %s\n", script_path);
+        return 2;
+    }
+    if (Bench_Setup() != 0)
+    {
+        return 2;
+    }
+
+    /* the driver stops lan_manager with SIGTERM, which only its loop may
+     * take, like SIGCHLD of supervised helpers */
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGTERM);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGCHLD);
+    pthread_sigmask(SIG_BLOCK, &mask, NULL);
+    if (pthread_create(&driver, NULL, Bench_Driver, NULL) != 0)
+    {
+        return 2;
+    }
+    rc = lan_manager_main(1, lnm_argv);
+    lnm_exited = 1;
+    pthread_join(driver, NULL);
+    fclose(script);
+    if (rc != 0 || script_failed)
+    {
+        return 2;
+    }
+    Bench_Report();
+    return expected_path != NULL ? Bench_Check() : 0;
+}
@@ -0,0 +1,453 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <spawn.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sysevent/sysevent.h>
+#include <syscfg/syscfg.h>
+#include <telemetry_busmessage_sender.h>
+#include "rdk_debug.h"
+#include "secure_wrapper.h"
+#include "lanmgr_fake.h"
+
+typedef struct
+{
+    unsigned int  tag;
+    uint64_t      sent_us;
+    char          name[64];
+    char          val[256];
+} LNM_FakeNotification;
+
+typedef struct LNM_FakeValue
+{
+    struct LNM_FakeValue  *next;
+    char                  *name;
+    char                  *val;
+} LNM_FakeValue;
+
+typedef struct
+{
+    int   fd;           /* handed to lan_manager */
+    int   peer;         /* notifications are written here */
+    int   num_subs;
+    char  subs[LNM_FAKE_MAX_SUBSCRIPTIONS][64];
+} LNM_FakeSession;
+
+static pthread_mutex_t fake_lock = PTHREAD_MUTEX_INITIALIZER;
+static LNM_FakeValue *sysevent_store = NULL;
+static LNM_FakeValue *syscfg_store = NULL;
+static LNM_FakeSession sessions[LNM_FAKE_MAX_SESSIONS];
+static int fake_verbose = 0;
+static LNM_FakeActionCb action_cb = NULL;
+static LNM_FakeRecvCb recv_cb = NULL;
+
+uint64_t LNM_FakeMonotonicUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* Called with fake_lock held. */
+static LNM_FakeValue *Fake_Find(LNM_FakeValue *store, const char *name)
+{
+    for (; store != NULL; store = store->next)
+    {
+        if (strcmp(store->name, name) == 0)
+        {
+            return store;
+        }
+    }
+    return NULL;
+}
+
+/* Called with fake_lock held. */
+static void Fake_Store(LNM_FakeValue **store, const char *name, const char *val)
+{
+    LNM_FakeValue *v = Fake_Find(*store, name);
+
+    if (v == NULL)
+    {
+        v = calloc(1, sizeof(*v));
+        if (v == NULL)
+        {
+            return;
+        }
+        v->name = strdup(name);
+        v->next = *store;
+        *store = v;
+    }
+    free(v->val);
+    v->val = strdup(val);
+}
+
+static void Fake_Clear(LNM_FakeValue **store)
+{
+    while (*store != NULL)
+    {
+        LNM_FakeValue *v = *store;
+
+        *store = v->next;
+        free(v->name);
+        free(v->val);
+        free(v);
+    }
+}
+
+static LNM_FakeSession *Fake_Session(int fd)
+{
+    int i;
+
+    for (i = 0; i < LNM_FAKE_MAX_SESSIONS; i++)
+    {
+        if (sessions[i].fd == fd && fd >= 0)
+        {
+            return &sessions[i];
+        }
+    }
+    return NULL;
+}
+
+/* Store the value and write it to every subscribed session. The writes
+ * happen unlocked so a full socket only ever blocks the caller. */
+static int Fake_Publish(const char *name, const char *val, unsigned int tag)
+{
+    LNM_FakeNotification n;
+    int peers[LNM_FAKE_MAX_SESSIONS];
+    int num_peers = 0, i, j, sent = 0;
+
+    memset(&n, 0, sizeof(n));
+    n.tag = tag;
+    snprintf(n.name, sizeof(n.name), "%s", name);
+    snprintf(n.val, sizeof(n.val), "%s", val);
+
+    pthread_mutex_lock(&fake_lock);
+    Fake_Store(&sysevent_store, name, val);
+    for (i = 0; i < LNM_FAKE_MAX_SESSIONS; i++)
+    {
+        for (j = 0; sessions[i].fd >= 0 && j < sessions[i].num_subs; j++)
+        {
+            if (strcmp(sessions[i].subs[j], name) == 0)
+            {
+                peers[num_peers++] = sessions[i].peer;
+                break;
+            }
+        }
+    }
+    pthread_mutex_unlock(&fake_lock);
+
+    n.sent_us = LNM_FakeMonotonicUs();
+    for (i = 0; i < num_peers; i++)
+    {
+        if (send(peers[i], &n, sizeof(n), MSG_NOSIGNAL) == (ssize_t)sizeof(n))
+        {
+            sent++;
+        }
+    }
+    return sent;
+}
+
+void LNM_FakeInit(int verbose, LNM_FakeActionCb action, LNM_FakeRecvCb recv)
+{
+    int i;
+
+    pthread_mutex_lock(&fake_lock);
+    Fake_Clear(&sysevent_store);
+    Fake_Clear(&syscfg_store);
+    for (i = 0; i < LNM_FAKE_MAX_SESSIONS; i++)
+    {
+        sessions[i].fd = -1;
+        sessions[i].peer = -1;
+        sessions[i].num_subs = 0;
+    }
+    fake_verbose = verbose;
+    action_cb = action;
+    recv_cb = recv;
+    pthread_mutex_unlock(&fake_lock);
+}
+
+void LNM_FakeSyscfgSet(const char *name, const char *val)
+{
+    pthread_mutex_lock(&fake_lock);
+    Fake_Store(&syscfg_store, name, val);
+    pthread_mutex_unlock(&fake_lock);
+}
+
+void LNM_FakeSyseventPreset(const char *name, const char *val)
+{
+    pthread_mutex_lock(&fake_lock);
+    Fake_Store(&sysevent_store, name, val);
+    pthread_mutex_unlock(&fake_lock);
+}
+
+int LNM_FakeSyseventNotify(const char *name, const char *val, unsigned int tag)
+{
+    return Fake_Publish(name, val, tag);
+}
+
+int LNM_FakeSyseventDrop(void)
+{
+    int i, dropped = 0;
+
+    pthread_mutex_lock(&fake_lock);
+    for (i = 0; i < LNM_FAKE_MAX_SESSIONS; i++)
+    {
+        if (sessions[i].fd >= 0 && sessions[i].num_subs > 0)
+        {
+            /* the owner sees the hang-up and closes its end */
+            shutdown(sessions[i].peer, SHUT_RDWR);
+            sessions[i].num_subs = 0;
+            dropped++;
+        }
+    }
+    pthread_mutex_unlock(&fake_lock);
+    return dropped;
+}
+
+/*
+ * sysevent
+ */
+int sysevent_open(char *ip, unsigned short port, int version, char *id, token_t *token)
+{
+    LNM_FakeSession *s = NULL;
+    int sv[2], i;
+
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sv) != 0)
+    {
+        return -1;
+    }
+    pthread_mutex_lock(&fake_lock);
+    for (i = 0; i < LNM_FAKE_MAX_SESSIONS && s == NULL; i++)
+    {
+        if (sessions[i].fd < 0)
+        {
+            s = &sessions[i];
+        }
+    }
+    if (s != NULL)
+    {
+        s->fd = sv[0];
+        s->peer = sv[1];
+        s->num_subs = 0;
+    }
+    pthread_mutex_unlock(&fake_lock);
+    if (s == NULL)
+    {
+        close(sv[0]);
+        close(sv[1]);
+        return -1;
+    }
+    *token = (token_t)(s - sessions) + 1;
+    return sv[0];
+}
+
+int sysevent_close(const int fd, const token_t token)
+{
+    LNM_FakeSession *s;
+
+    pthread_mutex_lock(&fake_lock);
+    s = Fake_Session(fd);
+    if (s != NULL)
+    {
+        close(s->peer);
+        s->fd = -1;
+        s->peer = -1;
+        s->num_subs = 0;
+    }
+    pthread_mutex_unlock(&fake_lock);
+    return close(fd);
+}
+
+int sysevent_get(const int fd, const token_t token, const char *inbuf, char *outbuf, int outbytes)
+{
+    LNM_FakeValue *v;
+
+    pthread_mutex_lock(&fake_lock);
+    v = Fake_Find(sysevent_store, inbuf);
+    snprintf(outbuf, outbytes, "%s", v != NULL ? v->val : "");
+    pthread_mutex_unlock(&fake_lock);
+    return 0;
+}
+
+int sysevent_set(const int fd, const token_t token, const char *name, const char *value, int conf_flags)
+{
+    if (action_cb != NULL)
+    {
+        action_cb("set", name, value != NULL ? value : "", LNM_FakeMonotonicUs());
+    }
+    Fake_Publish(name, value != NULL ? value : "", 0);
+    return 0;
+}
+
+int sysevent_setnotification(const int fd, const token_t token, char *name, async_id_t *async_id)
+{
+    LNM_FakeSession *s;
+    int rc = -1;
+
+    pthread_mutex_lock(&fake_lock);
+    s = Fake_Session(fd);
+    if (s != NULL && s->num_subs < LNM_FAKE_MAX_SUBSCRIPTIONS)
+    {
+        snprintf(s->subs[s->num_subs], sizeof(s->subs[0]), "%s", name);
+        async_id->trigger_id = (unsigned int)s->num_subs++;
+        async_id->action_id = 0;
+        rc = 0;
+    }
+    pthread_mutex_unlock(&fake_lock);
+    return rc;
+}
+
+int sysevent_getnotification(const int fd, const token_t token, char *namebuf, int *namebytes,
+                             char *valbuf, int *valbytes, async_id_t *async_id)
+{
+    LNM_FakeNotification n;
+    ssize_t len;
+
+    do
+    {
+        len = recv(fd, &n, sizeof(n), 0);
+    } while (len < 0 && errno == EINTR);
+    if (len != (ssize_t)sizeof(n))
+    {
+        return -1;
+    }
+    *namebytes = snprintf(namebuf, *namebytes, "%s", n.name);
+    *valbytes = snprintf(valbuf, *valbytes, "%s", n.val);
+    if (recv_cb != NULL && n.tag != 0)
+    {
+        recv_cb(n.tag, n.sent_us, LNM_FakeMonotonicUs());
+    }
+    return 0;
+}
+
+/*
+ * syscfg
+ */
+int syscfg_get(const char *ns, const char *name, char *out_value, int outbufsz)
+{
+    LNM_FakeValue *v;
+
+    pthread_mutex_lock(&fake_lock);
+    v = Fake_Find(syscfg_store, name);
+    if (v != NULL)
+    {
+        snprintf(out_value, outbufsz, "%s", v->val);
+    }
+    pthread_mutex_unlock(&fake_lock);
+    return v != NULL ? 0 : -1;
+}
+
+/*
+ * telemetry, secure_wrapper, rdk_logger
+ */
+T2ERROR t2_init(char *component)
+{
+    return 0;
+}
+
+T2ERROR t2_event_d(char *marker, int value)
+{
+    return 0;
+}
+
+T2ERROR t2_event_s(char *marker, char *value)
+{
+    return 0;
+}
+
+int v_secure_system(const char *format, ...)
+{
+    char cmd[256];
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf(cmd, sizeof(cmd), format, args);
+    va_end(args);
+    if (action_cb != NULL)
+    {
+        action_cb("system", cmd, "", LNM_FakeMonotonicUs());
+    }
+    return 0;
+}
+
+/* Supervised helpers: report the start and run a child that only waits for
+ * the SIGTERM of LNM_ProcStopAll(), so nothing from the device is executed. */
+int posix_spawn(pid_t *pid, const char *path, const posix_spawn_file_actions_t *file_actions,
+                const posix_spawnattr_t *attrp, char *const argv[], char *const envp[])
+{
+    sigset_t none;
+    pid_t child;
+
+    if (action_cb != NULL)
+    {
+        action_cb("spawn", path, "", LNM_FakeMonotonicUs());
+    }
+    child = fork();
+    if (child < 0)
+    {
+        return errno;
+    }
+    if (child == 0)
+    {
+        sigemptyset(&none);
+        sigprocmask(SIG_SETMASK, &none, NULL);
+        for (;;)
+        {
+            pause();
+        }
+    }
+    *pid = child;
+    return 0;
+}
+
+rdk_Error rdk_logger_init(const char *debug_ini)
+{
+    return RDK_SUCCESS;
+}
+
+rdk_Error rdk_logger_deinit(void)
+{
+    return RDK_SUCCESS;
+}
+
+int rdk_dbg_enabled(const char *module, rdk_LogLevel level)
+{
+    return level <= (fake_verbose ? RDK_LOG_INFO : RDK_LOG_ERROR);
+}
+
+void rdk_logger_msg_printf(rdk_LogLevel level, const char *module, const char *format, ...)
+{
+    va_list args;
+
+    if (level > (fake_verbose ? RDK_LOG_INFO : RDK_LOG_ERROR))
+    {
+        return;
+    }
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+}
@@ -0,0 +1,84 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_FAKE_H_
+#define _LANMGR_FAKE_H_
+
+#include <stdint.h>
+
+/**
+ * @brief In-process stand-in for syseventd, syscfg, telemetry, rdk_logger
+ *        and secure_wrapper.
+ *
+ * Every sysevent session is one end of a local socket pair. Values live in
+ * an in-memory store; a set of a name some session subscribed to is
+ * delivered to that session like syseventd would. Outbound actions, i.e.
+ * every sysevent_set, v_secure_system and helper spawn, are reported through
+ * a callback.
+ */
+#define LNM_FAKE_MAX_SESSIONS       16
+#define LNM_FAKE_MAX_SUBSCRIPTIONS  32
+
+/**
+ * @brief Outbound action: op is "set" (name=val) or "system" (name is the
+ *        command line, val is empty).
+ */
+typedef void (*LNM_FakeActionCb)(const char *op, const char *name, const char *val, uint64_t now_us);
+
+/**
+ * @brief A notification carrying tag was handed to lan_manager.
+ */
+typedef void (*LNM_FakeRecvCb)(unsigned int tag, uint64_t sent_us, uint64_t now_us);
+
+/**
+ * @brief LNM_FakeInit Reset the store and install the callbacks.
+ * @param[in] verbose forward lan_manager logs to stderr
+ */
+void LNM_FakeInit(int verbose, LNM_FakeActionCb action_cb, LNM_FakeRecvCb recv_cb);
+
+/**
+ * @brief LNM_FakeSyscfgSet Set the value syscfg_get returns for name.
+ */
+void LNM_FakeSyscfgSet(const char *name, const char *val);
+
+/**
+ * @brief LNM_FakeSyseventPreset Store a sysevent value without notifying.
+ */
+void LNM_FakeSyseventPreset(const char *name, const char *val);
+
+/**
+ * @brief LNM_FakeSyseventNotify Store a value and deliver it to every session
+ *        subscribed to name, as an external sysevent set would.
+ * @param[in] tag reported back through the receive callback, 0 for none
+ * @return number of sessions notified
+ */
+int LNM_FakeSyseventNotify(const char *name, const char *val, unsigned int tag);
+
+/**
+ * @brief LNM_FakeSyseventDrop Hang up every session with subscriptions, as
+ *        a syseventd restart would.
+ * @return number of sessions dropped
+ */
+int LNM_FakeSyseventDrop(void);
+
+/**
+ * @brief LNM_FakeMonotonicUs CLOCK_MONOTONIC in microseconds.
+ */
+uint64_t LNM_FakeMonotonicUs(void);
+
+#endif /* _LANMGR_FAKE_H_ */
@@ -0,0 +1,35 @@
+#!/bin/sh
+##########################################################################
+# If not stated otherwise in this file or this component's LICENSE
+# file the following copyright and licenses apply:
+#
+# Copyright 2026 RDK Management
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+##########################################################################
+# make check driver: replay one script and compare the outbound actions
+# with the .expected file next to it. A .pre script next to it is a previous
+# lan_manager run: it is replayed first and the script restarts on its state.
+script="$1"
+expected="${script%.lnm}.expected"
+pre="${script%.lnm}.pre"
+keep=
+
+if [ -f "$pre" ]; then
+    ./lan_manager_bench -q "$pre" >/dev/null || exit 1
+    keep=-k
+fi
+if [ -f "$expected" ]; then
+    exec ./lan_manager_bench -q $keep -c "$expected" "$script"
+fi
+exec ./lan_manager_bench -q $keep "$script"
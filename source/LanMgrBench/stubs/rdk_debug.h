@@ -0,0 +1,45 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+/* Off-device stand-in for rdk_logger, see lanmgr_fake.c. */
+#ifndef _LNM_BENCH_RDK_DEBUG_H_
+#define _LNM_BENCH_RDK_DEBUG_H_
+
+typedef enum
+{
+    RDK_LOG_FATAL = 0,
+    RDK_LOG_ERROR,
+    RDK_LOG_WARN,
+    RDK_LOG_NOTICE,
+    RDK_LOG_INFO,
+    RDK_LOG_DEBUG,
+    RDK_LOG_TRACE1
+} rdk_LogLevel;
+
+typedef int rdk_Error;
+#define RDK_SUCCESS  0
+
+#define RDK_LOG(level, module, ...)  rdk_logger_msg_printf(level, module, __VA_ARGS__)
+
+void rdk_logger_msg_printf(rdk_LogLevel level, const char *module, const char *format, ...)
+    __attribute__((format(printf, 3, 4)));
+rdk_Error rdk_logger_init(const char *debug_ini);
+rdk_Error rdk_logger_deinit(void);
+int rdk_dbg_enabled(const char *module, rdk_LogLevel level);
+
+#endif /* _LNM_BENCH_RDK_DEBUG_H_ */
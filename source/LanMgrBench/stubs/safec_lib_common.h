@@ -0,0 +1,37 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+/* Off-device stand-in for the safec helpers lan_manager uses. */
+#ifndef _LNM_BENCH_SAFEC_LIB_COMMON_H_
+#define _LNM_BENCH_SAFEC_LIB_COMMON_H_
+
+#include <stddef.h>
+#include <string.h>
+
+typedef int errno_t;
+#define EOK  0
+#define ERR_CHK(rc)
+
+static inline errno_t strcmp_s(const char *dest, size_t dmax, const char *src, int *indicator)
+{
+    (void)dmax;
+    *indicator = strcmp(dest, src);
+    return EOK;
+}
+
+#endif /* _LNM_BENCH_SAFEC_LIB_COMMON_H_ */
@@ -0,0 +1,29 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+/* Off-device stand-in for the telemetry sender, see lanmgr_fake.c. */
+#ifndef _LNM_BENCH_TELEMETRY_H_
+#define _LNM_BENCH_TELEMETRY_H_
+
+typedef int T2ERROR;
+
+T2ERROR t2_init(char *component);
+T2ERROR t2_event_d(char *marker, int value);
+T2ERROR t2_event_s(char *marker, char *value);
+
+#endif /* _LNM_BENCH_TELEMETRY_H_ */
@@ -44,13 +44,29 @@
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include "lanmgr_log.h"
+#include "lanmgr_evloop.h"
+#include "lanmgr_bridge.h"
+#include "lanmgr_bringup.h"
+#include "lanmgr_daemon.h"
+#include "lanmgr_event.h"
+#include "lanmgr_executor.h"
+#include "lanmgr_footprint.h"
+#include "lanmgr_journal.h"
+#include "lanmgr_proc.h"
+#include "lanmgr_rules.h"
+#include "lanmgr_setq.h"
+#include "lanmgr_state.h"
+#include "lanmgr_stats.h"
+#include "lanmgr_syscfg.h"
+#include "lanmgr_telemetry.h"
+#include "lanmgr_sysevent.h"
+#include "lanmgr_watchdog.h"
 #if !defined(_PLATFORM_RASPBERRYPI_)
 #include <sys/types.h>
 #endif
 #include <unistd.h>
 #include <sysevent/sysevent.h>
 #include <syscfg/syscfg.h>
-#include <pthread.h>
 #include <time.h>
 #include <telemetry_busmessage_sender.h>
 #include "safec_lib_common.h"
@@ -60,45 +76,61 @@
 #if defined(_PLATFORM_RASPBERRYPI_)
 #define PORT 8081
 #endif
-#ifdef MULTILAN_FEATURE
 #define BRG_INST_SIZE 5
-#define BUF_SIZE 256
-#endif
 
 #define BRMODE_ROUTER 0
-#define LOGGING_INTERVAL_SECS    ( 60 * 60 )
-/**************************************************************************/
-/*! \fn void *LNM_sysevent_threadfunc(void *data)
- **************************************************************************
- *  \brief Function to process sysevent event
- *  \return 0
-**************************************************************************/
+/* LAN_start sets must reach syseventd in order; lan-status follow-ups are
+ * independent of them. */
+#define LANE_LAN_START   LNM_SETQ_LANE_ORDERED
+#define LANE_LAN_STATUS  1
 typedef enum
 {
     DOCESAFE_ENABLE_DISABLE_extIf
 } DOCSIS_Esafe_Db_extIf_e;
 
+/* What LAN_start() brings up: lan-start for the router, bridge-start for
+ * the bridge and for the pseudo bridge of a disabled erouter. Persisted,
+ * keep the values. */
+typedef enum
+{
+    LNM_MODE_UNKNOWN,
+    LNM_MODE_ROUTER,
+    LNM_MODE_BRIDGE,
+    LNM_MODE_PSEUDO_BRIDGE
+} eLnmMode;
+
 typedef enum {
     BRING_LAN,
     PNM_STATUS,
     PRIMARY_LAN_13NET,
     LAN_STATUS,
+    BRIDGE_STATUS,
+    MODE_CHANGE,
     LNM_THREAD_ERROR
 } eLnmThreadType;
 
+_Static_assert(LNM_THREAD_ERROR <= LNM_STATS_EVENT_TYPES, "event types on the stats page");
+
+/* Counter names on the statistics page */
+static const char *const lnmThreadTypeNames[LNM_THREAD_ERROR] = {
+    [BRING_LAN]         = "bring_lan",
+    [PNM_STATUS]        = "pnm_status",
+    [PRIMARY_LAN_13NET] = "primary_lan_l3net",
+    [LAN_STATUS]        = "lan_status",
+    [BRIDGE_STATUS]     = "bridge_status",
+    [MODE_CHANGE]       = "mode_change",
+};
+
 typedef struct
 {
-    char         *msgStr;
-    eLnmThreadType mType;
+    char             *msgStr;
+    eLnmThreadType    mType;
+    LNM_EventHandler  handler;
+    unsigned int      deadlineMs;   /* 0 for LNM_WD_DEFAULT_DEADLINE_MSECS */
+    uint32_t          require;      /* subscribed only under this profile, see lanmgr_rules.h */
+    uint32_t          exclude;
 } LnmThread_MsgItem;
 
-LnmThread_MsgItem lnmthreadMsgArr[] = {
-    {"bring-lan",                                  BRING_LAN},
-    {"pnm-status",                                 PNM_STATUS},
-    {"primary_lan_l3net",                          PRIMARY_LAN_13NET},
-    {"lan-status",                                 LAN_STATUS}
-    };
-
 /**************************************************************************/
 /*      LOCAL DECLARATIONS:                                               */
 /**************************************************************************/
@@ -108,321 +140,455 @@ static void LAN_start();
 /**************************************************************************/
 /*      LOCAL VARIABLES:                                                  */
 /**************************************************************************/
-static int sysevent_fd;
-static token_t sysevent_token;
-static pthread_t sysevent_tid;
-static int pnm_inited = 0;
-static int netids_inited = 0;
-static int hotspot_started = 0;
-static int lan_telnet_started = 0;
-#ifdef CONFIG_CISCO_FEATURE_CISCOCONNECT
-static int ciscoconnect_started = 0;
-#endif
 static unsigned int factory_mode = 0;
 //static int bridgeModeInBootup = 0;
 static DOCSIS_Esafe_Db_extIf_e eRouterMode = DOCESAFE_ENABLE_DISABLE_extIf;
 static int bridge_mode = BRMODE_ROUTER;
+static eLnmMode lan_mode = LNM_MODE_UNKNOWN;    /* mode the LAN was brought up in, persisted */
 
 /**************************************************************************/
 /*      LOCAL FUNCTIONS:                                                  */
 /**************************************************************************/
 
-eLnmThreadType Get_LnmThreadType(char * name)
+static void Lan_Manager_PublishModes(int brmode, int ermode, int lan_start)
 {
-    errno_t rc       = -1;
-    int     ind      = -1;
-    eLnmThreadType ret = LNM_THREAD_ERROR;
-    if (name != NULL && name[0] != '\0')
-    {
-        int i;
-        for (i = 0; i < LNM_THREAD_ERROR; i++) {
-            rc = strcmp_s(lnmthreadMsgArr[i].msgStr,strlen(lnmthreadMsgArr[i].msgStr),name,&ind);
-            ERR_CHK(rc);
-            if((ind==0) && (rc == EOK))
-            {
-                ret = lnmthreadMsgArr[i].mType;
-                break;
-            }
-        }
+    LNM_StatsSnapshot *snap = LNM_StatsBegin();
+
+    snap->bridge_mode = brmode;
+    snap->erouter_mode = ermode;
+    if (lan_start)
+    {
+        snap->last_lan_start = (int64_t)time(NULL);
+        snap->last_lan_start_ms = LNM_MonotonicMs();
     }
-    return ret;
+    LNM_StatsCommit();
 }
 
-static int LNM_SysCfgGetInt(const char *name)
+static eLnmMode Lan_Manager_Mode(int brmode, int ermode)
 {
-   LanManagerInfo(("LNM_SysCfgGetInt\n"));
-   char out_value[20];
-   int outbufsz = sizeof(out_value);
-        LanManagerInfo((" %s : name = %s \n", __FUNCTION__, name));
-   if (!syscfg_get(NULL, name, out_value, outbufsz))
-   {
-        LanManagerInfo((" value = %s \n", out_value));
-      return atoi(out_value);
-   }
-   else
-   {
-        LanManagerError((" syscfg get failed \n"));
-      return -1;
-   }
+    // mipieper - add erouter check for pseudo bridge. Can remove if bridge_mode is forced in response to erouter_mode.
+    if (brmode != BRMODE_ROUTER)
+    {
+        return LNM_MODE_BRIDGE;
+    }
+    return ermode != 0 ? LNM_MODE_ROUTER : LNM_MODE_PSEUDO_BRIDGE;
+}
+
+static const char *Lan_Manager_ModeName(eLnmMode mode)
+{
+    switch (mode)
+    {
+    case LNM_MODE_ROUTER:        return "router";
+    case LNM_MODE_BRIDGE:        return "bridge";
+    case LNM_MODE_PSEUDO_BRIDGE: return "pseudo bridge";
+    default:                     return "unknown";
+    }
+}
+
+static void Lan_Manager_SetMode(eLnmMode mode)
+{
+    lan_mode = mode;
+    LNM_StateBegin()->lan_mode = (uint32_t)mode;
+    LNM_StateCommit();
+}
+
+/* lan-start or bridge-start for mode, then what goes with either, all on
+ * the ordered lane. */
+static void Lan_Manager_StartMode(eLnmMode mode, LNM_SetDoneCb done)
+{
+    if (mode == LNM_MODE_ROUTER)
+    {
+        LanManagerInfo(("Utopia starting lan...\n"));
+        LanManagerInfo((" Setting lan-start event \n"));
+        LNM_SyseventSetAsync("lan-start", "", LANE_LAN_START, done, NULL);
+    }
+    else
+    {
+        LanManagerInfo(("Utopia starting bridge...\n"));
+        LanManagerInfo((" Setting bridge-start event \n"));
+        LNM_SyseventSetAsync("bridge-start", "", LANE_LAN_START, done, NULL);
+    }
+    Lan_Manager_SetMode(mode);
+    /* dslite, dhcp_server-resync, ... on the same ordered lane */
+    LNM_RulesFire(LNM_RULE_LAN_START);
+}
+
+static void LAN_start_set_done(unsigned int seq, int rc, void *arg)
+{
+    LNM_BringupStartDone(rc);
+    LNM_TelemetryMark(LNM_STAGE_LAN_START_SET);
+}
+
+static void Mode_switch_set_done(unsigned int seq, int rc, void *arg)
+{
+    LNM_TelemetryMark(LNM_STAGE_MODE_SWITCHED);
 }
 
 static void LAN_start(void)
 {
     LanManagerInfo((" Entry %s \n", __FUNCTION__));
+    LNM_TelemetryMark(LNM_STAGE_LAN_START);
+    /* keys without a change event may have been set but not committed */
+    LNM_SysCfgCacheRefresh();
     // LAN Start May Be Delayed so refresh modes.
+    /* the modes are evented, but may be set before the event is sent */
+    LNM_SysCfgCacheInvalidate(LNM_CFG_BRIDGE_MODE);
+    LNM_SysCfgCacheInvalidate(LNM_CFG_LAST_EROUTER_MODE);
     LanManagerInfo(("The Previous EROUTERMODE=%d\n",eRouterMode));
     LanManagerInfo(("The Previous BRIDGE MODE=%d\n",bridge_mode));
-    bridge_mode = LNM_SysCfgGetInt("bridge_mode");
-    eRouterMode = LNM_SysCfgGetInt("last_erouter_mode");
+    bridge_mode = LNM_SysCfgCacheGetInt(LNM_CFG_BRIDGE_MODE);
+    eRouterMode = LNM_SysCfgCacheGetInt(LNM_CFG_LAST_EROUTER_MODE);
     LanManagerInfo(("The Refreshed EROUTERMODE=%d\n",eRouterMode));
     LanManagerInfo(("The Refreshed BRIDGE MODE=%d\n",bridge_mode));
-    if (bridge_mode == 0 && eRouterMode != 0) // mipieper - add erouter check for pseudo bridge. Can remove if bridge_mode is forced in response to erouter_mode.
+    LNM_StatsInc(LNM_STAT_LAN_STARTS);
+    Lan_Manager_PublishModes(bridge_mode, eRouterMode, 1);
+    Lan_Manager_StartMode(Lan_Manager_Mode(bridge_mode, eRouterMode), LAN_start_set_done);
+   return;
+}
+
+
+/**************************************************************************/
+/*! \fn static void LNM_HandlePnmStatus(const char *name, const char *val)
+ **************************************************************************
+ *  \brief bring-lan / pnm-status handler. Starts the LAN once the primary
+ *         l3net is known as well; see lanmgr_bringup for the coalescing.
+**************************************************************************/
+static void LNM_HandlePnmStatus(const char *name, const char *val)
+{
+    LanManagerInfo((" bring-lan/pnm-status received \n"));
+    LNM_TelemetryMark(LNM_STAGE_PNM);
+    LNM_BringupTrigger(LNM_BRINGUP_PNM, val);
+}
+
+/**************************************************************************/
+/*! \fn static void LNM_HandlePrimaryL3net(const char *name, const char *val)
+ **************************************************************************
+ *  \brief primary_lan_l3net handler. Starts the LAN once pnm is up as well.
+**************************************************************************/
+static void LNM_HandlePrimaryL3net(const char *name, const char *val)
+{
+    LanManagerInfo((" primary_lan_l3net received \n"));
+    LNM_TelemetryMark(LNM_STAGE_L3NET);
+#if defined (_PROPOSED_BUG_FIX_)
+    if (LNM_BringupSeen(LNM_BRINGUP_PNM))
     {
-        LanManagerInfo(("Utopia starting lan...\n"));
-        LanManagerInfo((" Setting lan-start event \n"));           
-        sysevent_set(sysevent_fd, sysevent_token, "lan-start", "", 0);
-        
-        
-    } else {
-        // TODO: fix this
-        LanManagerInfo(("Utopia starting bridge...\n"));
-        LanManagerInfo((" Setting bridge-start event \n"));         
-        sysevent_set(sysevent_fd, sysevent_token, "bridge-start", "", 0);
+        LanManagerInfo(("***STARTING LAN***\n"));
     }
-    
-#ifdef DSLITE_FEATURE_SUPPORT
+#endif
+    LNM_BringupTrigger(LNM_BRINGUP_L3NET, val);
+}
+
+/* Helpers that run while the LAN is up. brlan0 exists in router and in
+ * bridge mode. LNM_ProcStart() keeps a single instance, a repeat is harmless. */
+static void Lan_Manager_StartHelpers(void)
+{
+    if (factory_mode)
     {
-        char buf[2];
-        if ((syscfg_get(NULL, "4_to_6_enabled", buf, sizeof(buf)) == 0) && (strcmp(buf, "1") == 0))
+        /* -F: stay in the foreground so telnetd remains our child */
+        static char *const telnetd_argv[] = { "/usr/sbin/telnetd", "-F", "-l", "/usr/sbin/cli", "-i", "brlan0", NULL };
+
+        if (LNM_ProcStart("telnetd", telnetd_argv) == 0)
         {
-            LanManagerInfo(("Setting dslite_enabled event\n"));
-            sysevent_set(sysevent_fd, sysevent_token, "dslite_enabled", "1", 0);
+            LanManagerInfo(("factorymode\n"));
         }
     }
-#endif
-    //ADD MORE LAN NETWORKS HERE
-    LanManagerInfo((" Setting dhcp_server-resync event \n"));     
-    sysevent_set(sysevent_fd, sysevent_token, "dhcp_server-resync", "", 0);
-   
-   return;
 }
 
-
-static void *LNM_sysevent_threadfunc(void *data)
+/**************************************************************************/
+/*! \fn static void LNM_HandleLanStatus(const char *name, const char *val)
+ **************************************************************************
+ *  \brief lan-status / bridge-status handler. Brings up the services that
+ *         depend on the LAN when it goes from stopped to started; the same
+ *         status reported again brings up nothing.
+**************************************************************************/
+static void LNM_HandleLanStatus(const char *name, const char *val)
 {
-    async_id_t primary_lan_l3net_asyncid;
-    async_id_t lan_status_asyncid;
-    //async_id_t bridge_status_asyncid;
-    async_id_t pnm_asyncid;
-    time_t time_now = { 0 }, time_before = { 0 };
-    LanManagerInfo((" Entry %s \n", __FUNCTION__));
-    sysevent_setnotification(sysevent_fd, sysevent_token, "primary_lan_l3net",  &primary_lan_l3net_asyncid);
-    sysevent_setnotification(sysevent_fd, sysevent_token, "lan-status",  &lan_status_asyncid);
-    //sysevent_setnotification(sysevent_fd, sysevent_token, "bridge-status",  &bridge_status_asyncid);
-    #if !defined(INTEL_PUMA7) && !defined(_COSA_BCM_MIPS_) && !defined(_COSA_BCM_ARM_) && !defined(_COSA_QCA_ARM_)
-    sysevent_setnotification(sysevent_fd, sysevent_token, "bring-lan",  &pnm_asyncid);
-    #else
-    sysevent_setnotification(sysevent_fd, sysevent_token, "pnm-status",  &pnm_asyncid);
-    #endif
-    LanManagerInfo((" Set notifications done \n"));
-    for (;;)
-    {
-    #ifdef MULTILAN_FEATURE
-        char name[64], val[64], buf[BUF_SIZE];
-    #else
-        char name[64], val[64];
-    #ifdef CONFIG_CISCO_HOME_SECURITY
-        char  buffer[10];
-    #endif
-    #endif
-        int namelen = sizeof(name);
-        int vallen  = sizeof(val);
-        int err;
-        async_id_t getnotification_asyncid;
-        errno_t rc = -1;
-        int ind = -1;
-    #ifdef MULTILAN_FEATURE
-        errno_t rc1 = -1;
-        int ind1 = -1;
-        char brlan0_inst[BRG_INST_SIZE] = {0};
-        char brlan1_inst[BRG_INST_SIZE] = {0};
-        char* l3net_inst = NULL;
-    #endif
-    
-     LanManagerInfo(("get notification\n"));
-     err = sysevent_getnotification(sysevent_fd, sysevent_token, name, &namelen,  val, &vallen, &getnotification_asyncid);
-     if (err)
-     {
-            /*
-             * Log should come for every 1hour
-             * - time_now = getting current time
-             * - difference between time now and previous time is greater than
-             -       *    3600 seconds
-             * - time_before = getting current time as for next iteration
-             *    checking
-             */
-            LanManagerInfo(("err received\n"));
-            time(&time_now);
-            if(LOGGING_INTERVAL_SECS <= ((unsigned int)difftime(time_now, time_before)))
-            {
-                printf("%s-ERR: %d\n", __func__, err);
-                time(&time_before);
-            }
-            sleep(10);
-     }
-     else
-     {
-            LanManagerInfo((" %s : name = %s, val = %s \n", __FUNCTION__, name, val ));
-            eLnmThreadType ret_value;
-            ret_value = Get_LnmThreadType(name);
-            /*if (ret_value == WEBUI_FLAG_RESET)
-            {
-                LanManagerInfo(("webui flag reset\n"));
-                webui_started = 0;
-            }*/
-#if !defined(INTEL_PUMA7) && !defined(_COSA_BCM_MIPS_) && !defined(_COSA_BCM_ARM_) && !defined(_COSA_QCA_ARM_)
-            if (ret_value == BRING_LAN)
-#else
-            if (ret_value == PNM_STATUS)
-#endif
-            {
-                LanManagerInfo((" bring-lan/pnm-status received \n"));
-                pnm_inited = 1;
-                if (netids_inited)
-                {
-                        LanManagerInfo((" Starting lan for PNM_status \n"));
-                        LAN_start();
-                }
-            }
-            else if (ret_value == PRIMARY_LAN_13NET)
-            {
-                  LanManagerInfo((" primary_lan_l3net received \n"));
-                  if (pnm_inited)
-                  {
-#if defined (_PROPOSED_BUG_FIX_)
-                      LanManagerInfo(("***STARTING LAN***\n"));
-#endif
-                      LanManagerInfo((" Starting lan for Primary lan 13net\n"));
-                      LAN_start();
-                  }
-                  netids_inited = 1;
-            }
-            else if ( ret_value == LAN_STATUS )
-            {
+    char brlan0_inst[BRG_INST_SIZE] = {0};
+    char brlan1_inst[BRG_INST_SIZE] = {0};
+    eLnmLink link = strcmp(name, "bridge-status") == 0 ? LNM_LINK_BRIDGE : LNM_LINK_LAN;
+    eLnmEdge edge;
+
 #if defined (_PROPOSED_BUG_FIX_)
-                  LanManagerInfo(("***LAN STATUS/BRIDGE STATUS RECIEVED****\n"));
-                  LanManagerInfo(("THE EVENT =%s VALUE=%s\n",name,val));
-#endif
-                  LanManagerInfo(("***LAN STATUS/BRIDGE STATUS RECIEVED****\n"));
-                  rc = strcmp_s("started", strlen("started"),val, &ind);
-                  ERR_CHK(rc);
-                  if ((ind == 0) && (rc == EOK))
-                  {
-#ifdef CONFIG_CISCO_HOME_SECURITY
-                      //Piggy back off the webui start event to signal XHS startup
-                      sysevent_get(sysevent_fd, sysevent_token, "homesecurity_lan_l3net", buffer, sizeof(buffer));
-                      if (buffer[0] != '\0') sysevent_set(sysevent_fd, sysevent_token, "ipv4-up", buffer, 0);
-#endif	  
-
-#if defined(RDK_ONEWIFI) && (defined(_XB6_PRODUCT_REQ_) || defined(_WNXL11BWL_PRODUCT_REQ_))
-                      LanManagerInfo(("CALL VLAN UTIL TO SET UP LNF\n"));
-#if defined(_RDKB_GLOBAL_PRODUCT_REQ_)
-                      char lnfEnabled[8] = {0};
-                      syscfg_get(NULL, "lost_and_found_enable", lnfEnabled, sizeof(lnfEnabled));
-                      if(strncmp(lnfEnabled, "false", 5) != 0)
-                      {
-                           sysevent_set(sysevent_fd, sysevent_token, "lnf-setup","6", 0);
-	              }
-#else
-                      sysevent_set(sysevent_fd, sysevent_token, "lnf-setup","6", 0);
-#endif
-#endif
- 
-                    
-#ifdef MULTILAN_FEATURE
-                       LanManagerInfo((" sysevent get for primary lan,homesecurity lanand l3net\n"));
-                       sysevent_get(sysevent_fd, sysevent_token, "primary_lan_l3net", brlan0_inst, sizeof(brlan0_inst));
-                       sysevent_get(sysevent_fd, sysevent_token, "homesecurity_lan_l3net", brlan1_inst, sizeof(brlan1_inst));
-                       /*Get the active bridge instances and bring up the bridges */
-                       sysevent_get(sysevent_fd, sysevent_token, "l3net_instances", buf, sizeof(buf));
-                       l3net_inst = strtok(buf, " ");
-                       while(l3net_inst != NULL)
-                       {
-                          rc = strcmp_s(l3net_inst, strlen(l3net_inst),brlan0_inst, &ind);
-                          ERR_CHK(rc);
-                          rc1 = strcmp_s(l3net_inst, strlen(l3net_inst),brlan1_inst, &ind1);
-                          ERR_CHK(rc);
-                          /*brlan0 and brlan1 are already up. We should not call their instances again*/
-                          if(!(((ind == 0) && (rc == EOK)) || ((ind1 == 0) && (rc1 == EOK))))
-                          {
-                              sysevent_set(sysevent_fd, sysevent_token, "ipv4-up", l3net_inst, 0);
-                          }
-                          l3net_inst = strtok(NULL, " ");
-                      }
-#endif
-                      if (!hotspot_started)
-                      {
-                          LanManagerInfo(("hotspot not started\n"));
-#if defined(INTEL_PUMA7) || defined(_COSA_BCM_MIPS_) || defined(_COSA_BCM_ARM_) ||  defined(_COSA_INTEL_XB3_ARM_) || defined(_COSA_QCA_ARM_)
-                          printf("Not Calling hotspot-start for XB3,XB6 and CBR it will be done in \
-                                  cosa_start_rem.sh,hotspot.service and xfinity_hotspot_bridge_setup.sh respectively\n");
-#else
-                          sysevent_set(sysevent_fd, sysevent_token, "hotspot-start", "", 0);
-                          hotspot_started = 1 ;
-#endif
-                      }
-                      if (factory_mode && lan_telnet_started == 0)
-                      {
-                          LanManagerInfo(("factorymode\n"));
-                          v_secure_system("/usr/sbin/telnetd -l /usr/sbin/cli -i brlan0");
-                          lan_telnet_started=1;
-                      }
-#ifdef CONFIG_CISCO_FEATURE_CISCOCONNECT
-                      if (!ciscoconnect_started)
-                      {
-                          sysevent_set(sysevent_fd, sysevent_token, "ciscoconnect-restart", "", 0);
-                          ciscoconnect_started = 1 ;
-                      }
+    LanManagerInfo(("***LAN STATUS/BRIDGE STATUS RECIEVED****\n"));
+    LanManagerInfo(("THE EVENT =%s VALUE=%s\n",name,val));
 #endif
-                  }
-              }
-            }
+    LanManagerInfo(("***LAN STATUS/BRIDGE STATUS RECIEVED****\n"));
+    edge = LNM_BridgeStatus(link, val);
+    if (edge != LNM_EDGE_NONE && link == (lan_mode == LNM_MODE_ROUTER ? LNM_LINK_LAN : LNM_LINK_BRIDGE))
+    {
+        LNM_BringupLinkEdge(edge == LNM_EDGE_UP);
+    }
+    if (link == LNM_LINK_LAN && edge == LNM_EDGE_UP)
+    {
+        LNM_TelemetryMark(LNM_STAGE_LAN_STARTED);
+        /* ipv4-up for XHS, lnf-setup, hotspot-start, ... */
+        LNM_RulesFire(LNM_RULE_LAN_STARTED);
+    }
+    if (link == LNM_LINK_LAN && LNM_RulesProfileMatch(LNM_PROFILE_MULTILAN, 0))
+    {
+        if (edge == LNM_EDGE_DOWN)
+        {
+            /* bridges go down with the LAN, bring all of them up next time */
+            LNM_BridgeReset();
         }
-    return 0;
+        else if (strcmp(val, "started") == 0)
+        {
+            /* also without an edge: instances may have been added, and
+             * the sync only brings up the ones that are not up yet */
+            LanManagerInfo((" sysevent get for primary lan,homesecurity lanand l3net\n"));
+            LNM_SyseventGet("primary_lan_l3net", brlan0_inst, sizeof(brlan0_inst));
+            LNM_SyseventGet("homesecurity_lan_l3net", brlan1_inst, sizeof(brlan1_inst));
+            /*Get the active bridge instances and bring up the bridges */
+            LNM_BridgeSync(brlan0_inst, brlan1_inst);
+        }
+    }
+    if (edge != LNM_EDGE_UP)
+    {
+        if (edge == LNM_EDGE_NONE && strcmp(val, "started") == 0)
+        {
+            LanManagerInfoRL((" %s started again, nothing to bring up \n", name));
+        }
+        return;
+    }
+    Lan_Manager_StartHelpers();
 }
 
-static int Lan_Manager_Init()
+/* Bring the LAN from the mode it was started in to the configured one:
+ * stop what runs and start the new mode, nothing more. */
+static void Lan_Manager_ApplyMode(const char *why)
 {
-    LanManagerInfo((" starting lan manager init \n"));
-    sysevent_fd = sysevent_open("127.0.0.1", SE_SERVER_WELL_KNOWN_PORT, SE_VERSION, "lan_manager", &sysevent_token);
-    LanManagerInfo((" sysevent_fd %d \n", sysevent_fd));
-     if (sysevent_fd >= 0)
+    eLnmMode mode = Lan_Manager_Mode(bridge_mode, eRouterMode);
+
+    if (!LNM_StateFlag(LNM_STATE_LAN_STARTED) || lan_mode == LNM_MODE_UNKNOWN)
     {
-        LanManagerInfo((" Creating Thread  LNM_sysevent_threadfunc \n"));
-        pthread_create(&sysevent_tid, NULL, LNM_sysevent_threadfunc, NULL);
+        LanManagerInfo((" %s: mode %s, the LAN is not up yet \n", why, Lan_Manager_ModeName(mode)));
+        return;
     }
-    return 0;
+    if (mode == lan_mode)
+    {
+        return;
+    }
+    LanManagerInfo((" %s: mode %s -> %s \n", why, Lan_Manager_ModeName(lan_mode), Lan_Manager_ModeName(mode)));
+    if ((lan_mode == LNM_MODE_ROUTER) == (mode == LNM_MODE_ROUTER))
+    {
+        /* bridge and pseudo bridge run the same bridge-start, nothing to issue */
+        Lan_Manager_SetMode(mode);
+        return;
+    }
+    LNM_TelemetryMark(LNM_STAGE_MODE_CHANGE);
+    LNM_StatsInc(LNM_STAT_MODE_SWITCHES);
+    LNM_SyseventSetAsync(lan_mode == LNM_MODE_ROUTER ? "lan-stop" : "bridge-stop", "", LANE_LAN_START, NULL, NULL);
+    Lan_Manager_StartMode(mode, Mode_switch_set_done);
 }
 
-pid_t findProcessId(char* processName)
+/* Pick up where the previous instance left off, on the executor like every
+ * handler: a mode change that landed while lan_manager was not running
+ * first, then the helpers and the bring-up. */
+static void Lan_Manager_Resume(void *arg)
 {
-    FILE *f = NULL;
-    pid_t pid = -1;
-    char request[256], response[256];
-    snprintf(request, sizeof(request), "ps  | grep %s", processName);
-    if ((f = popen(request, "r")) != NULL)
+    if (LNM_StateFlag(LNM_STATE_LAN_STARTED))
     {
-        fgets(response, (255), f);
-        pclose(f);
+        Lan_Manager_ApplyMode("restart");
     }
-    snprintf(request,sizeof(request), "pidof %s", processName);
-    if ((f = popen(request, "r")) != NULL)
+    if (LNM_StateFlag(LNM_STATE_LAN_UP | LNM_STATE_BRIDGE_UP))
     {
-        fgets(response, (255), f);
-        pid = atoi(response);
-        pclose(f);
+        /* helpers died with the previous instance, the up edge will not
+         * come again */
+        Lan_Manager_StartHelpers();
     }
-    return pid;
+    LNM_BringupResume();
+}
+
+/**************************************************************************/
+/*! \fn static void LNM_HandleModeChange(const char *name, const char *val)
+ **************************************************************************
+ *  \brief bridge_mode / erouter_mode-updated handler. Re-reads the modes
+ *         and, if the LAN is up in another mode, switches it over. Before
+ *         the LAN is up the next LAN_start() picks the new mode.
+**************************************************************************/
+static void LNM_HandleModeChange(const char *name, const char *val)
+{
+    if (LNM_SysCfgCacheNotify(name))
+    {
+        LanManagerInfo((" syscfg change announced by %s \n", name));
+    }
+    bridge_mode = LNM_SysCfgCacheGetInt(LNM_CFG_BRIDGE_MODE);
+    eRouterMode = LNM_SysCfgCacheGetInt(LNM_CFG_LAST_EROUTER_MODE);
+    Lan_Manager_PublishModes(bridge_mode, eRouterMode, 0);
+    Lan_Manager_ApplyMode(name);
+}
+
+/* Events lan_manager reacts to. New events only need an entry here.
+ * lan-status and bridge-status may spawn telnetd and sync every bridge,
+ * give them more time. */
+static const LnmThread_MsgItem lnmthreadMsgArr[] = {
+    {"bring-lan",                                  BRING_LAN,          LNM_HandlePnmStatus,     0,     0,                      LNM_PROFILE_PNM_STATUS},
+    {"pnm-status",                                 PNM_STATUS,         LNM_HandlePnmStatus,     0,     LNM_PROFILE_PNM_STATUS, 0},
+    {"primary_lan_l3net",                          PRIMARY_LAN_13NET,  LNM_HandlePrimaryL3net,  0,     0,                      0},
+    {"lan-status",                                 LAN_STATUS,         LNM_HandleLanStatus,     5000,  0,                      0},
+    {"bridge-status",                              BRIDGE_STATUS,      LNM_HandleLanStatus,     5000,  0,                      0},
+    {"bridge_mode",                                MODE_CHANGE,        LNM_HandleModeChange,    0,     0,                      0},
+    {"erouter_mode-updated",                       MODE_CHANGE,        LNM_HandleModeChange,    0,     0,                      0}
+    };
+
+/* What the LAN lifecycle sets besides lan-start itself, in firing order.
+ * Platform differences are profile bits, see lanmgr_rules.h. */
+static const LNM_Rule lnmRules[] = {
+    { .trigger = LNM_RULE_LAN_START, .require = LNM_PROFILE_DSLITE,
+      .guard_val = "1", .guard_cfg = LNM_CFG_4_TO_6_ENABLED,
+      .set_name = "dslite_enabled", .set_val = "1", .lane = LANE_LAN_START },
+    //ADD MORE LAN NETWORKS HERE
+    { .trigger = LNM_RULE_LAN_START,
+      .set_name = "dhcp_server-resync", .set_val = "", .lane = LANE_LAN_START },
+    //Piggy back off the webui start event to signal XHS startup
+    { .trigger = LNM_RULE_LAN_STARTED, .require = LNM_PROFILE_HOME_SECURITY,
+      .set_name = "ipv4-up", .set_val_from = "homesecurity_lan_l3net", .lane = LANE_LAN_STATUS },
+    { .trigger = LNM_RULE_LAN_STARTED, .require = LNM_PROFILE_LNF, .exclude = LNM_PROFILE_LNF_SWITCH,
+      .set_name = "lnf-setup", .set_val = "6", .lane = LANE_LAN_STATUS },
+    { .trigger = LNM_RULE_LAN_STARTED, .require = LNM_PROFILE_LNF | LNM_PROFILE_LNF_SWITCH,
+      .guard_val = "false", .guard_cfg = LNM_CFG_LOST_AND_FOUND_ENABLE, .guard_not = 1,
+      .set_name = "lnf-setup", .set_val = "6", .lane = LANE_LAN_STATUS },
+    /* XB3, XB6 and CBR start hotspot from cosa_start_rem.sh, hotspot.service
+     * and xfinity_hotspot_bridge_setup.sh */
+    { .trigger = LNM_RULE_LAN_STARTED, .exclude = LNM_PROFILE_EXT_HOTSPOT, .once = LNM_STATE_HOTSPOT_STARTED,
+      .set_name = "hotspot-start", .set_val = "", .lane = LANE_LAN_STATUS },
+    { .trigger = LNM_RULE_LAN_STARTED, .require = LNM_PROFILE_CISCOCONNECT, .once = LNM_STATE_CISCOCONNECT_STARTED,
+      .set_name = "ciscoconnect-restart", .set_val = "", .lane = LANE_LAN_STATUS },
+    };
+
+/* No persisted state, either the first start since boot or the file was
+ * unusable: rebuild it from the values syseventd still holds, so triggers
+ * that fired before we subscribed are not waited for forever. */
+static void Lan_Manager_RebuildState(void)
+{
+    LNM_PersistState *ps;
+    char val[LNM_STATE_VAL_SIZE];
+    char lan_status[16];
+    unsigned int i;
+    int trigger;
+
+    ps = LNM_StateBegin();
+    for (i = 0; i < sizeof(lnmthreadMsgArr) / sizeof(lnmthreadMsgArr[0]); i++)
+    {
+        if (!LNM_RulesProfileMatch(lnmthreadMsgArr[i].require, lnmthreadMsgArr[i].exclude))
+        {
+            continue;
+        }
+        switch (lnmthreadMsgArr[i].mType)
+        {
+        case BRING_LAN:
+        case PNM_STATUS:
+            trigger = LNM_BRINGUP_PNM;
+            break;
+        case PRIMARY_LAN_13NET:
+            trigger = LNM_BRINGUP_L3NET;
+            break;
+        default:
+            continue;
+        }
+        if (LNM_SyseventGet(lnmthreadMsgArr[i].msgStr, val, sizeof(val)) == 0 && val[0] != '\0')
+        {
+            ps->triggers[trigger].seen = 1;
+            snprintf(ps->triggers[trigger].val, sizeof(ps->triggers[trigger].val), "%s", val);
+        }
+    }
+    /* the LAN is already up, do not start it a second time; the status
+     * that is up tells the mode it was started in */
+    if (LNM_SyseventGet("lan-status", lan_status, sizeof(lan_status)) == 0 && strcmp(lan_status, "started") == 0)
+    {
+        /* whatever its start brought up is up already as well */
+        ps->flags |= LNM_STATE_LAN_STARTED | LNM_STATE_LAN_UP;
+        ps->lan_mode = LNM_MODE_ROUTER;
+    }
+    if (LNM_SyseventGet("bridge-status", val, sizeof(val)) == 0 && strcmp(val, "started") == 0)
+    {
+        ps->flags |= LNM_STATE_BRIDGE_UP;
+        if (!(ps->flags & LNM_STATE_LAN_STARTED))
+        {
+            eLnmMode mode = Lan_Manager_Mode(bridge_mode, eRouterMode);
+
+            ps->flags |= LNM_STATE_LAN_STARTED;
+            ps->lan_mode = mode != LNM_MODE_ROUTER ? mode : LNM_MODE_BRIDGE;
+        }
+    }
+    if (ps->flags & LNM_STATE_LAN_STARTED)
+    {
+        for (i = 0; i < LNM_STATE_TRIGGERS; i++)
+        {
+            memcpy(ps->triggers[i].started_val, ps->triggers[i].val, sizeof(ps->triggers[i].started_val));
+        }
+    }
+    LNM_StateCommit();
+    LanManagerInfo((" state rebuilt from sysevent: pnm %s, l3net %s, lan-status \"%s\" \n",
+                    ps->triggers[LNM_BRINGUP_PNM].seen ? "seen" : "not seen",
+                    ps->triggers[LNM_BRINGUP_L3NET].seen ? "seen" : "not seen", lan_status));
+}
+
+static int Lan_Manager_Init()
+{
+    unsigned int i;
+    int window;
+
+    LanManagerInfo((" starting lan manager init \n"));
+    LNM_TelemetryInit();
+    LNM_StatsInit(LNM_STATS_FILE);
+    LNM_BridgeInit(LNM_FootprintLow());
+    for (i = 0; i < LNM_THREAD_ERROR; i++)
+    {
+        LNM_StatsEventName(i, lnmThreadTypeNames[i]);
+    }
+    if (LNM_SetQueueInit(LNM_SETQ_DEFAULT_WORKERS) != 0)
+    {
+        LanManagerWarn((" set queue unavailable, sysevent sets are synchronous \n"));
+    }
+    /* the profile decides which events are subscribed */
+    LNM_RulesInit(lnmRules, sizeof(lnmRules) / sizeof(lnmRules[0]));
+    for (i = 0; i < sizeof(lnmthreadMsgArr) / sizeof(lnmthreadMsgArr[0]); i++)
+    {
+        if (!LNM_RulesProfileMatch(lnmthreadMsgArr[i].require, lnmthreadMsgArr[i].exclude))
+        {
+            continue;
+        }
+        LNM_EventRegister(lnmthreadMsgArr[i].msgStr, lnmthreadMsgArr[i].mType, lnmthreadMsgArr[i].handler,
+                          lnmthreadMsgArr[i].deadlineMs);
+    }
+    /* the loop only receives, handlers run on the executor */
+    if (LNM_ExecutorInit(LNM_EventDispatch) != 0)
+    {
+        LanManagerWarn((" executor unavailable, handlers run on the event loop \n"));
+    }
+    if (LNM_SyseventInit(LNM_ExecutorPostEvent) != 0)
+    {
+        return -1;
+    }
+    /* after connecting, so the cache starts out on the current session */
+    LNM_SysCfgCacheInit();
+    bridge_mode = LNM_SysCfgCacheGetInt(LNM_CFG_BRIDGE_MODE);
+    eRouterMode = LNM_SysCfgCacheGetInt(LNM_CFG_LAST_EROUTER_MODE);
+    Lan_Manager_PublishModes(bridge_mode, eRouterMode, 0);
+    factory_mode = LNM_SysCfgCacheGetInt(LNM_CFG_FACTORY_MODE) > 0;
+    window = LNM_SysCfgCacheGetInt(LNM_CFG_LAN_START_COALESCE_MS);
+    LNM_BringupInit(LAN_start, window >= 0 ? (unsigned int)window : LNM_BRINGUP_DEFAULT_WINDOW_MSECS);
+    /* notifications are registered already, nothing fired since is lost */
+    if (LNM_StateInit(LNM_STATE_FILE))
+    {
+        LanManagerInfo((" restarted, resuming from %s \n", LNM_STATE_FILE));
+    }
+    else
+    {
+        Lan_Manager_RebuildState();
+    }
+    if (LNM_StateFlag(LNM_STATE_LAN_STARTED))
+    {
+        /* started by a previous instance, the mode may have changed since */
+        lan_mode = (eLnmMode)LNM_StateGet()->lan_mode;
+        if (lan_mode == LNM_MODE_UNKNOWN)
+        {
+            lan_mode = Lan_Manager_Mode(bridge_mode, eRouterMode);
+        }
+    }
+    LNM_ExecutorPost(Lan_Manager_Resume, NULL);
+    return 0;
 }
 
 #if defined(_ANSC_LINUX)
@@ -455,23 +621,65 @@ static void daemonize(void) {
  **************************************************************************/
 int main(int argc, char *argv[])
 {
+    int rc;
+
+    /* before the first thread and the first stdio use; the cache is loaded
+     * once logging is up */
+    LNM_FootprintInit(LNM_SysCfgPeekInt(LNM_CFG_LOW_FOOTPRINT) > 0);
     printf("Started lan_manager\n");
 #if defined(_ANSC_LINUX)
-    daemonize();
+    /* under Type=notify the service manager tracks this very process */
+    if (!LNM_DaemonSupervised())
+    {
+        daemonize();
+    }
 #endif
-    t2_init("lanmanager");
-    LanManagerLogInit();
-    Lan_Manager_Init();
-    LanManagerInfo(("wait in loop \n"));
-    while (1)
+    /* after daemonize so the pidfile names the process that holds the lock */
+    rc = LNM_DaemonLock(LNM_PID_FILE);
+    if (rc != 0)
     {
-        sleep(1);
+        printf("%s\n", rc > 0 ? "Already running" : "lan_manager: cannot lock pidfile");
+        return 1;
     }
-    if( findProcessId(argv[0]) > 0 )
+    LNM_FootprintLock();
+    /* only the instance holding the lock writes the journal */
+    LNM_JournalInit(LNM_JOURNAL_FILE);
+    /* before t2_init so no helper thread inherits an unblocked SIGTERM */
+    if (LNM_EvLoopInit() != 0)
     {
-        printf("Already running\n");
-        LanManagerInfo((" lan_manager already running. Returning...\n"));
+        printf("lan_manager: event loop init failed\n");
         return 1;
     }
+    /* SIGCHLD too must be blocked before the first thread exists */
+    if (LNM_ProcInit() != 0)
+    {
+        printf("lan_manager: cannot watch SIGCHLD, helpers are not restarted\n");
+    }
+    t2_init("lanmanager");
+    LanManagerLogInit();
+    /* keep log I/O off the notification path */
+    LanManagerLogAsyncStart();
+    if (Lan_Manager_Init() != 0)
+    {
+        /* deaf to every event: exit so the service manager restarts us */
+        LanManagerError((" lan manager init failed, exiting \n"));
+        LNM_ExecutorStop();
+        LNM_SetQueueStop();
+        LanManagerLogDeinit();
+        return 1;
+    }
+    /* keep-alives only flow while the loop runs and no worker is hung */
+    LNM_WatchdogStart();
+    LanManagerInfo(("wait in loop \n"));
+    LNM_EvLoopRun();
+    LanManagerInfo((" event loop exited \n"));
+    LNM_DaemonNotify("STOPPING=1");
+    LNM_ExecutorStop();
+    LNM_ProcStopAll();
+    LNM_SetQueueStop();
+    LNM_TelemetryDump();
+    LNM_FootprintDump();
+    LNM_ExecutorDump();
+    LanManagerLogDeinit();
     return 0;
 }
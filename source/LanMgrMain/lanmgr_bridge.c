@@ -0,0 +1,332 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lanmgr_bridge.h"
+#include "lanmgr_log.h"
+#include "lanmgr_setq.h"
+#include "lanmgr_state.h"
+#include "lanmgr_stats.h"
+#include "lanmgr_sysevent.h"
+
+#define BRIDGE_INST_NONE  ULONG_MAX     /* no instance to skip */
+
+typedef enum
+{
+    BRIDGE_QUEUED,      /* ipv4-up still to be issued */
+    BRIDGE_INFLIGHT,
+    BRIDGE_UP,
+    BRIDGE_FAILED       /* retried on the next sync */
+} eBridgeState;
+
+typedef struct
+{
+    unsigned long  inst;
+    unsigned int   gen;
+    eBridgeState   state;
+} LNM_BridgeEntry;
+
+static LNM_BridgeEntry *bridges = NULL;
+static unsigned int num_bridges = 0;
+static unsigned int max_bridges = 0;
+static unsigned int cap_bridges = UINT_MAX;
+static unsigned int sync_gen = 0;
+static unsigned int inflight = 0;
+static char *list_buf = NULL;
+static int list_size = 0;
+static int cap_list_size = LNM_BRIDGE_LIST_MAX_SIZE;
+
+static void Bridge_Pump(void);
+
+static LNM_BridgeEntry *Bridge_Find(unsigned long inst)
+{
+    unsigned int i;
+
+    for (i = 0; i < num_bridges; i++)
+    {
+        if (bridges[i].inst == inst)
+        {
+            return &bridges[i];
+        }
+    }
+    return NULL;
+}
+
+static LNM_BridgeEntry *Bridge_Add(unsigned long inst)
+{
+    if (num_bridges == max_bridges)
+    {
+        unsigned int n = max_bridges ? max_bridges * 2 : 16;
+        LNM_BridgeEntry *p;
+
+        if (n > cap_bridges)
+        {
+            n = cap_bridges;
+        }
+        p = n > max_bridges ? realloc(bridges, n * sizeof(*p)) : NULL;
+        if (p == NULL)
+        {
+            LanManagerErrorRL((" bridge table full at %u instances \n", num_bridges));
+            return NULL;
+        }
+        bridges = p;
+        max_bridges = n;
+    }
+    bridges[num_bridges].inst = inst;
+    bridges[num_bridges].state = BRIDGE_QUEUED;
+    return &bridges[num_bridges++];
+}
+
+/* Read l3net_instances, growing the buffer until the value fits. A value
+ * that still does not fit is cut after its last complete instance, and
+ * *complete is cleared. */
+static const char *Bridge_ReadList(int *complete)
+{
+    *complete = 1;
+    for (;;)
+    {
+        if (list_buf == NULL)
+        {
+            list_buf = malloc(LNM_BRIDGE_LIST_MIN_SIZE);
+            if (list_buf == NULL)
+            {
+                return "";
+            }
+            list_size = LNM_BRIDGE_LIST_MIN_SIZE;
+        }
+        if (LNM_SyseventGet("l3net_instances", list_buf, list_size) != 0)
+        {
+            return "";
+        }
+        if ((int)strlen(list_buf) < list_size - 1)
+        {
+            return list_buf;
+        }
+        if (list_size >= cap_list_size)
+        {
+            break;
+        }
+        {
+            char *p = realloc(list_buf, list_size * 2);
+            if (p == NULL)
+            {
+                break;
+            }
+            list_buf = p;
+            list_size *= 2;
+        }
+    }
+    /* keep what fits rather than nothing, but not the instance cut in two:
+     * "12" must not become 1 */
+    LanManagerWarnRL((" l3net_instances truncated at %d bytes \n", list_size));
+    *complete = 0;
+    {
+        char *last = strrchr(list_buf, ' ');
+
+        if (last != NULL)
+        {
+            *last = '\0';
+        }
+        else
+        {
+            list_buf[0] = '\0';
+        }
+    }
+    return list_buf;
+}
+
+static void Bridge_Done(unsigned int seq, int rc, void *arg)
+{
+    LNM_BridgeEntry *b = Bridge_Find((unsigned long)(uintptr_t)arg);
+
+    inflight--;
+    if (b != NULL && b->state == BRIDGE_INFLIGHT)
+    {
+        b->state = rc == 0 ? BRIDGE_UP : BRIDGE_FAILED;
+    }
+    Bridge_Pump();
+}
+
+static void Bridge_Pump(void)
+{
+    unsigned int i;
+    char inst[16];
+
+    for (i = 0; i < num_bridges && inflight < LNM_BRIDGE_MAX_INFLIGHT; i++)
+    {
+        if (bridges[i].state == BRIDGE_QUEUED)
+        {
+            bridges[i].state = BRIDGE_INFLIGHT;
+            inflight++;
+            snprintf(inst, sizeof(inst), "%lu", bridges[i].inst);
+            LNM_SyseventSetAsync("ipv4-up", inst, LNM_BRIDGE_LANE_BASE + (unsigned int)bridges[i].inst,
+                                 Bridge_Done, (void *)(uintptr_t)bridges[i].inst);
+        }
+    }
+}
+
+/* 0 is a valid instance, an empty or non numeric value skips nothing. */
+static unsigned long Bridge_ParseInst(const char *s)
+{
+    char *end;
+    unsigned long inst;
+
+    if (s == NULL || *s == '\0')
+    {
+        return BRIDGE_INST_NONE;
+    }
+    inst = strtoul(s, &end, 10);
+    return end != s ? inst : BRIDGE_INST_NONE;
+}
+
+void LNM_BridgeSync(const char *skip0, const char *skip1)
+{
+    unsigned long skip_a = Bridge_ParseInst(skip0);
+    unsigned long skip_b = Bridge_ParseInst(skip1);
+    int complete;
+    const char *p = Bridge_ReadList(&complete);
+    unsigned int i, n, added = 0;
+
+    sync_gen++;
+    /* walk the list in place, no token copies */
+    while (*p != '\0')
+    {
+        char *end;
+        unsigned long inst;
+        LNM_BridgeEntry *b;
+
+        if (*p == ' ')
+        {
+            p++;
+            continue;
+        }
+        inst = strtoul(p, &end, 10);
+        if (end == p)
+        {
+            LanManagerWarn((" bad l3net instance list near \"%.16s\" \n", p));
+            while (*p != '\0' && *p != ' ')
+            {
+                p++;
+            }
+            continue;
+        }
+        p = end;
+        /*brlan0 and brlan1 are already up. We should not call their instances again*/
+        if (inst == skip_a || inst == skip_b)
+        {
+            continue;
+        }
+        b = Bridge_Find(inst);
+        if (b == NULL)
+        {
+            b = Bridge_Add(inst);
+            if (b == NULL)
+            {
+                continue;
+            }
+            added++;
+        }
+        else if (b->state == BRIDGE_FAILED)
+        {
+            b->state = BRIDGE_QUEUED;
+            added++;
+        }
+        b->gen = sync_gen;
+    }
+    /* drop instances that left the list, they are brought up again if they
+     * return; a truncated list does not tell which ones left */
+    for (i = 0, n = 0; i < num_bridges; i++)
+    {
+        if (bridges[i].gen == sync_gen || !complete)
+        {
+            bridges[n++] = bridges[i];
+        }
+    }
+    LanManagerInfo((" l3net instances: %u active, %u to bring up, %u removed \n", n, added, num_bridges - n));
+    num_bridges = n;
+    Bridge_Pump();
+}
+
+void LNM_BridgeInit(int low)
+{
+    if (!low)
+    {
+        return;
+    }
+    /* allocated once, before the startup footprint is taken, and never grown */
+    bridges = malloc(LNM_BRIDGE_LOW_MAX_INSTANCES * sizeof(*bridges));
+    max_bridges = bridges != NULL ? LNM_BRIDGE_LOW_MAX_INSTANCES : 0;
+    cap_bridges = max_bridges;
+    list_buf = malloc(LNM_BRIDGE_LOW_LIST_SIZE);
+    list_size = list_buf != NULL ? LNM_BRIDGE_LOW_LIST_SIZE : 0;
+    cap_list_size = list_buf != NULL ? LNM_BRIDGE_LOW_LIST_SIZE : LNM_BRIDGE_LIST_MIN_SIZE;
+}
+
+void LNM_BridgeReset(void)
+{
+    num_bridges = 0;
+}
+
+unsigned int LNM_BridgeCount(void)
+{
+    return num_bridges;
+}
+
+eLnmEdge LNM_BridgeStatus(eLnmLink link, const char *status)
+{
+    static const uint32_t link_flags[LNM_LINK_MAX] = {
+        [LNM_LINK_LAN]    = LNM_STATE_LAN_UP,
+        [LNM_LINK_BRIDGE] = LNM_STATE_BRIDGE_UP,
+    };
+    int up;
+
+    if (link < 0 || link >= LNM_LINK_MAX)
+    {
+        return LNM_EDGE_NONE;
+    }
+    if (strcmp(status, "started") == 0)
+    {
+        up = 1;
+    }
+    else if (strcmp(status, "stopped") == 0)
+    {
+        up = 0;
+    }
+    else
+    {
+        return LNM_EDGE_NONE;
+    }
+    if (LNM_StateFlag(link_flags[link]) == up)
+    {
+        LNM_StatsInc(LNM_STAT_STATUS_REPEATS);
+        return LNM_EDGE_NONE;
+    }
+    if (up)
+    {
+        LNM_StateSetFlag(link_flags[link]);
+    }
+    else
+    {
+        LNM_StateClearFlag(link_flags[link]);
+    }
+    return up ? LNM_EDGE_UP : LNM_EDGE_DOWN;
+}
@@ -0,0 +1,248 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <stdio.h>
+#include <string.h>
+#include "lanmgr_bringup.h"
+#include "lanmgr_executor.h"
+#include "lanmgr_log.h"
+#include "lanmgr_state.h"
+#include "lanmgr_stats.h"
+#include "lanmgr_telemetry.h"
+
+_Static_assert(LNM_BRINGUP_TRIGGER_MAX == LNM_STATE_TRIGGERS, "persisted trigger count");
+
+/* Trigger values live in the persisted state, see lanmgr_state.h. The
+ * generation counters are rebuilt from it by LNM_BringupResume(). */
+static eLnmBringupState state = LNM_BRINGUP_WAITING;
+static LNM_BringupStartFn start_fn = NULL;
+static unsigned int window_msecs = LNM_BRINGUP_DEFAULT_WINDOW_MSECS;
+static unsigned int generation = 0;
+static unsigned int started_generation = 0;
+static unsigned int suppressed = 0;
+static unsigned int coalesced = 0;
+static int window_timer = -1;
+static char starting_val[LNM_BRINGUP_TRIGGER_MAX][LNM_STATE_VAL_SIZE];
+
+/* Mirror the bring-up state on the statistics page. */
+static void Bringup_Publish(void)
+{
+    const LNM_PersistState *ps = LNM_StateGet();
+    LNM_StatsSnapshot *snap = LNM_StatsBegin();
+
+    snap->bringup_state = state;
+    snap->pnm_seen = ps->triggers[LNM_BRINGUP_PNM].seen;
+    snap->l3net_seen = ps->triggers[LNM_BRINGUP_L3NET].seen;
+    LNM_StatsCommit();
+}
+
+static void Bringup_Suppressed(void)
+{
+    suppressed++;
+    LNM_StatsInc(LNM_STAT_TRIGGERS_SUPPRESSED);
+}
+
+static void Bringup_Start(void *arg)
+{
+    const LNM_PersistState *ps = LNM_StateGet();
+    int i;
+
+    window_timer = -1;
+    started_generation = generation;
+    state = LNM_BRINGUP_STARTED;
+    /* persisted by LNM_BringupStartDone() once the start reached syseventd */
+    for (i = 0; i < LNM_BRINGUP_TRIGGER_MAX; i++)
+    {
+        memcpy(starting_val[i], ps->triggers[i].val, sizeof(starting_val[i]));
+    }
+    LanManagerInfo((" starting lan, generation %u, %u trigger(s) coalesced, %u suppressed in total \n",
+                    generation, coalesced, suppressed));
+    coalesced = 0;
+    Bringup_Publish();
+    if (start_fn != NULL)
+    {
+        start_fn();
+    }
+}
+
+void LNM_BringupInit(LNM_BringupStartFn start, unsigned int window_ms)
+{
+    start_fn = start;
+    window_msecs = window_ms;
+    LanManagerInfo((" lan start coalescing window %u ms \n", window_msecs));
+}
+
+/* Schedule a LAN start at the end of the coalescing window. The start runs
+ * on the executor whatever the window and whoever the caller. */
+static void Bringup_Schedule(void)
+{
+    LNM_TelemetryMark(LNM_STAGE_TRIGGERED);
+    state = LNM_BRINGUP_PENDING;
+    Bringup_Publish();
+    if (window_msecs != 0)
+    {
+        window_timer = LNM_ExecutorAddTimer(window_msecs, Bringup_Start, NULL);
+        if (window_timer > 0)
+        {
+            return;
+        }
+        LanManagerError((" no timer for the lan start window, starting without it \n"));
+    }
+    if (LNM_ExecutorOnThread())
+    {
+        /* handlers run here, no other thread touches the bring-up state */
+        Bringup_Start(NULL);
+    }
+    else
+    {
+        LNM_ExecutorPost(Bringup_Start, NULL);
+    }
+}
+
+static int Bringup_AllSeen(const LNM_PersistState *ps)
+{
+    return ps->triggers[LNM_BRINGUP_PNM].seen && ps->triggers[LNM_BRINGUP_L3NET].seen;
+}
+
+void LNM_BringupTrigger(eLnmBringupTrigger trigger, const char *val)
+{
+    const LNM_PersistState *ps = LNM_StateGet();
+    const LNM_StateTrigger *cur;
+
+    if (trigger < 0 || trigger >= LNM_BRINGUP_TRIGGER_MAX)
+    {
+        return;
+    }
+    cur = &ps->triggers[trigger];
+    if (!cur->seen || strncmp(cur->val, val, sizeof(cur->val) - 1) != 0)
+    {
+        LNM_StateTrigger *t = &LNM_StateBegin()->triggers[trigger];
+
+        t->seen = 1;
+        snprintf(t->val, sizeof(t->val), "%s", val);
+        LNM_StateCommit();
+        generation++;
+        Bringup_Publish();
+    }
+
+    if (!Bringup_AllSeen(ps))
+    {
+        return;
+    }
+    if (state == LNM_BRINGUP_PENDING)
+    {
+        /* folded into the start already scheduled */
+        coalesced++;
+        Bringup_Suppressed();
+        return;
+    }
+    if (generation == started_generation)
+    {
+        Bringup_Suppressed();
+        LanManagerInfo((" lan already started for this state, %u duplicate trigger(s) suppressed \n", suppressed));
+        return;
+    }
+    Bringup_Schedule();
+}
+
+void LNM_BringupStartDone(int rc)
+{
+    LNM_PersistState *ps;
+    int i;
+
+    if (rc != 0)
+    {
+        return;
+    }
+    ps = LNM_StateBegin();
+    for (i = 0; i < LNM_BRINGUP_TRIGGER_MAX; i++)
+    {
+        memcpy(ps->triggers[i].started_val, starting_val[i], sizeof(ps->triggers[i].started_val));
+    }
+    ps->flags |= LNM_STATE_LAN_STARTED;
+    LNM_StateCommit();
+}
+
+void LNM_BringupResume(void)
+{
+    const LNM_PersistState *ps = LNM_StateGet();
+    int i, seen = 0, same = 1;
+
+    for (i = 0; i < LNM_BRINGUP_TRIGGER_MAX; i++)
+    {
+        seen += ps->triggers[i].seen != 0;
+        same = same && strcmp(ps->triggers[i].val, ps->triggers[i].started_val) == 0;
+    }
+    Bringup_Publish();
+    if (seen == 0)
+    {
+        return;
+    }
+    generation = 1;
+    if ((ps->flags & LNM_STATE_LAN_STARTED) && same)
+    {
+        started_generation = generation;
+        state = LNM_BRINGUP_STARTED;
+        Bringup_Publish();
+        LanManagerInfo((" resuming: lan already started for pnm \"%s\" l3net \"%s\" \n",
+                        ps->triggers[LNM_BRINGUP_PNM].val, ps->triggers[LNM_BRINGUP_L3NET].val));
+        return;
+    }
+    if (!Bringup_AllSeen(ps))
+    {
+        LanManagerInfo((" resuming: %d of %d bring-up trigger(s) already seen \n", seen, LNM_BRINGUP_TRIGGER_MAX));
+        return;
+    }
+    LanManagerInfo((" resuming: both triggers seen, lan not started for them yet \n"));
+    Bringup_Schedule();
+}
+
+void LNM_BringupLinkEdge(int up)
+{
+    if (!up && state == LNM_BRINGUP_STARTED)
+    {
+        /* a deliberate bring-lan after a lan-stop must not be taken for a
+         * duplicate of the trigger that started the LAN */
+        started_generation = 0;
+        state = LNM_BRINGUP_STOPPED;
+        LanManagerInfo((" lan went down, the next trigger starts it again \n"));
+        Bringup_Publish();
+    }
+    else if (up && state == LNM_BRINGUP_STOPPED)
+    {
+        /* back up on its own, e.g. restarted by the start script */
+        started_generation = generation;
+        state = LNM_BRINGUP_STARTED;
+        Bringup_Publish();
+    }
+}
+
+int LNM_BringupSeen(eLnmBringupTrigger trigger)
+{
+    return (trigger >= 0 && trigger < LNM_BRINGUP_TRIGGER_MAX) ? (int)LNM_StateGet()->triggers[trigger].seen : 0;
+}
+
+eLnmBringupState LNM_BringupState(void)
+{
+    return state;
+}
+
+unsigned int LNM_BringupSuppressed(void)
+{
+    return suppressed;
+}
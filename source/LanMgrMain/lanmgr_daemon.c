@@ -0,0 +1,133 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "lanmgr_daemon.h"
+#include "lanmgr_footprint.h"
+#include "lanmgr_log.h"
+
+static int pid_fd = -1;
+static int ready_sent = 0;
+
+int LNM_DaemonLock(const char *pidfile)
+{
+    char buf[16];
+    int len;
+
+    pid_fd = open(pidfile, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (pid_fd < 0)
+    {
+        LanManagerError((" cannot open %s, errno=%d \n", pidfile, errno));
+        return -1;
+    }
+    if (flock(pid_fd, LOCK_EX | LOCK_NB) != 0)
+    {
+        int err = errno;
+
+        close(pid_fd);
+        pid_fd = -1;
+        if (err == EWOULDBLOCK)
+        {
+            return 1;
+        }
+        LanManagerError((" cannot lock %s, errno=%d \n", pidfile, err));
+        return -1;
+    }
+    len = snprintf(buf, sizeof(buf), "%d\n", (int)getpid());
+    if (ftruncate(pid_fd, 0) != 0 || write(pid_fd, buf, len) != len)
+    {
+        /* the lock is what matters, the pid is informational */
+        LanManagerWarn((" cannot write %s, errno=%d \n", pidfile, errno));
+    }
+    return 0;
+}
+
+int LNM_DaemonSupervised(void)
+{
+    const char *path = getenv("NOTIFY_SOCKET");
+
+    return path != NULL && path[0] != '\0';
+}
+
+int LNM_DaemonNotify(const char *state)
+{
+    const char *path = getenv("NOTIFY_SOCKET");
+    struct sockaddr_un addr;
+    socklen_t addrlen;
+    size_t pathlen;
+    ssize_t sent;
+    int fd;
+
+    if (path == NULL || path[0] == '\0')
+    {
+        return 0;
+    }
+    pathlen = strlen(path);
+    if ((path[0] != '/' && path[0] != '@') || pathlen >= sizeof(addr.sun_path))
+    {
+        LanManagerError((" unsupported NOTIFY_SOCKET %s \n", path));
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path, path, pathlen);
+    if (path[0] == '@')
+    {
+        /* abstract namespace */
+        addr.sun_path[0] = '\0';
+    }
+    addrlen = (socklen_t)(offsetof(struct sockaddr_un, sun_path) + pathlen);
+
+    fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    sent = sendto(fd, state, strlen(state), MSG_NOSIGNAL, (struct sockaddr *)&addr, addrlen);
+    close(fd);
+    if (sent < 0)
+    {
+        LanManagerError((" sd_notify %s failed, errno=%d \n", state, errno));
+        return -1;
+    }
+    return 0;
+}
+
+void LNM_DaemonReady(void)
+{
+    if (ready_sent)
+    {
+        return;
+    }
+    ready_sent = 1;
+    LNM_FootprintReport();
+    if (LNM_DaemonSupervised())
+    {
+        LanManagerInfo((" notifications registered, reporting ready \n"));
+        LNM_DaemonNotify("READY=1");
+    }
+}
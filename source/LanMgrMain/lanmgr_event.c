@@ -0,0 +1,124 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "lanmgr_event.h"
+#include "lanmgr_log.h"
+#include "lanmgr_stats.h"
+#include "lanmgr_sysevent.h"
+#include "lanmgr_watchdog.h"
+
+_Static_assert(LNM_EVENT_HASH_SIZE >= 2 * LNM_EVENT_MAX_HANDLERS, "event hash load factor");
+
+typedef struct
+{
+    char              name[64];
+    uint32_t          hash;
+    int               type;
+    unsigned int      deadline_ms;
+    LNM_EventHandler  handler;
+} LNM_EventEntry;
+
+static LNM_EventEntry event_table[LNM_EVENT_HASH_SIZE];
+static int num_events = 0;
+
+static uint32_t Event_Hash(const char *name)
+{
+    uint32_t hash = 2166136261u;
+
+    while (*name != '\0')
+    {
+        hash ^= (unsigned char)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/* Returns the slot holding name, or the empty slot where it would go. */
+static LNM_EventEntry *Event_Find(const char *name, uint32_t hash)
+{
+    uint32_t i = hash & (LNM_EVENT_HASH_SIZE - 1);
+
+    while (event_table[i].handler != NULL)
+    {
+        if (event_table[i].hash == hash && strcmp(event_table[i].name, name) == 0)
+        {
+            break;
+        }
+        i = (i + 1) & (LNM_EVENT_HASH_SIZE - 1);
+    }
+    return &event_table[i];
+}
+
+int LNM_EventRegister(const char *name, int type, LNM_EventHandler handler, unsigned int deadline_ms)
+{
+    LNM_EventEntry *e;
+    uint32_t hash;
+
+    if (name == NULL || handler == NULL || strlen(name) >= sizeof(e->name) ||
+        num_events >= LNM_EVENT_MAX_HANDLERS)
+    {
+        LanManagerError((" cannot register handler for %s \n", name ? name : "(null)"));
+        return -1;
+    }
+    hash = Event_Hash(name);
+    e = Event_Find(name, hash);
+    if (e->handler != NULL)
+    {
+        LanManagerError((" handler for %s already registered \n", name));
+        return -1;
+    }
+    /* a handler without its notification would never run */
+    if (LNM_SyseventSubscribe(name) != 0)
+    {
+        return -1;
+    }
+    snprintf(e->name, sizeof(e->name), "%s", name);
+    e->hash = hash;
+    e->type = type;
+    e->deadline_ms = deadline_ms;
+    e->handler = handler;
+    num_events++;
+    return 0;
+}
+
+int LNM_EventLookup(const char *name)
+{
+    LNM_EventEntry *e = Event_Find(name, Event_Hash(name));
+
+    return e->handler != NULL ? e->type : -1;
+}
+
+void LNM_EventDispatch(const char *name, const char *val)
+{
+    LNM_EventEntry *e = Event_Find(name, Event_Hash(name));
+
+    LanManagerInfo((" %s : name = %s, val = %s \n", __FUNCTION__, name, val ));
+    if (e->handler == NULL)
+    {
+        LanManagerWarnRL((" no handler for event %s \n", name));
+        LNM_StatsInc(LNM_STAT_EVENTS_UNKNOWN);
+        return;
+    }
+    LNM_StatsEvent(e->type);
+    LNM_WatchdogBegin(e->name, e->deadline_ms);
+    e->handler(name, val);
+    LNM_WatchdogEnd();
+}
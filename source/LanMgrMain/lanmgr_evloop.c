@@ -0,0 +1,344 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include "lanmgr_evloop.h"
+#include "lanmgr_log.h"
+
+#define LNM_EV_MAX_EVENTS  8
+
+typedef struct
+{
+    int         fd;
+    LNM_EvFdCb  cb;
+    void       *arg;
+} LNM_EvFd;
+
+typedef struct
+{
+    int            id;
+    uint64_t       deadline_ms;
+    LNM_EvTimerCb  cb;
+    void          *arg;
+} LNM_EvTimer;
+
+typedef struct
+{
+    LNM_EvSignalCb  cb;
+    void           *arg;
+} LNM_EvSignal;
+
+static int epoll_fd = -1;
+static int timer_fd = -1;
+static int signal_fd = -1;
+static sigset_t signal_mask;
+static volatile int loop_running = 0;
+static int next_timer_id = 1;
+static LNM_EvFd ev_fds[LNM_EV_MAX_FDS];
+static pthread_mutex_t timer_lock = PTHREAD_MUTEX_INITIALIZER;  /* ev_timers, next_timer_id */
+static LNM_EvTimer ev_timers[LNM_EV_MAX_TIMERS];
+static LNM_EvSignal ev_signals[_NSIG];
+
+uint64_t LNM_MonotonicMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+uint64_t LNM_MonotonicUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static LNM_EvFd *EvLoop_FindFd(int fd)
+{
+    int i;
+    for (i = 0; i < LNM_EV_MAX_FDS; i++)
+    {
+        if (ev_fds[i].cb != NULL && ev_fds[i].fd == fd)
+        {
+            return &ev_fds[i];
+        }
+    }
+    return NULL;
+}
+
+/* Arm the timerfd for the earliest pending deadline, or disarm it when no
+ * timer is pending so the loop sleeps until real work arrives. Called with
+ * timer_lock held. */
+static void EvLoop_RearmTimer(void)
+{
+    struct itimerspec its;
+    uint64_t earliest = 0;
+    int i;
+
+    for (i = 0; i < LNM_EV_MAX_TIMERS; i++)
+    {
+        if (ev_timers[i].cb != NULL && (earliest == 0 || ev_timers[i].deadline_ms < earliest))
+        {
+            earliest = ev_timers[i].deadline_ms;
+        }
+    }
+    memset(&its, 0, sizeof(its));
+    if (earliest != 0)
+    {
+        its.it_value.tv_sec = earliest / 1000;
+        its.it_value.tv_nsec = (earliest % 1000) * 1000000;
+    }
+    if (timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &its, NULL) < 0)
+    {
+        LanManagerError(("%s: timerfd_settime failed, errno=%d\n", __FUNCTION__, errno));
+    }
+}
+
+static void EvLoop_TimerExpired(int fd, uint32_t events, void *arg)
+{
+    LNM_EvTimer expired[LNM_EV_MAX_TIMERS];
+    uint64_t expirations;
+    uint64_t now;
+    int i, n = 0;
+
+    if (read(fd, &expirations, sizeof(expirations)) < 0 && errno != EAGAIN)
+    {
+        LanManagerError(("%s: timerfd read failed, errno=%d\n", __FUNCTION__, errno));
+    }
+    now = LNM_MonotonicMs();
+    pthread_mutex_lock(&timer_lock);
+    for (i = 0; i < LNM_EV_MAX_TIMERS; i++)
+    {
+        if (ev_timers[i].cb != NULL && ev_timers[i].deadline_ms <= now)
+        {
+            expired[n++] = ev_timers[i];
+            /* release the slot first so the callback may reschedule itself */
+            ev_timers[i].cb = NULL;
+        }
+    }
+    EvLoop_RearmTimer();
+    pthread_mutex_unlock(&timer_lock);
+    /* callbacks run unlocked, they may add or cancel timers */
+    for (i = 0; i < n; i++)
+    {
+        expired[i].cb(expired[i].arg);
+    }
+}
+
+static void EvLoop_SignalReceived(int fd, uint32_t events, void *arg)
+{
+    struct signalfd_siginfo si;
+
+    while (read(fd, &si, sizeof(si)) == sizeof(si))
+    {
+        if (si.ssi_signo < _NSIG && ev_signals[si.ssi_signo].cb != NULL)
+        {
+            ev_signals[si.ssi_signo].cb((int)si.ssi_signo, ev_signals[si.ssi_signo].arg);
+        }
+    }
+}
+
+static void EvLoop_StopOnSignal(int signo, void *arg)
+{
+    LanManagerInfo((" signal %d received, stopping event loop \n", signo));
+    LNM_EvLoopStop();
+}
+
+int LNM_EvLoopInit(void)
+{
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (epoll_fd < 0 || timer_fd < 0)
+    {
+        LanManagerError(("%s: epoll/timerfd create failed, errno=%d\n", __FUNCTION__, errno));
+        return -1;
+    }
+    sigemptyset(&signal_mask);
+    if (LNM_EvLoopAddFd(timer_fd, EPOLLIN, EvLoop_TimerExpired, NULL) != 0 ||
+        LNM_EvLoopAddSignal(SIGTERM, EvLoop_StopOnSignal, NULL) != 0 ||
+        LNM_EvLoopAddSignal(SIGINT, EvLoop_StopOnSignal, NULL) != 0)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+int LNM_EvLoopAddFd(int fd, uint32_t events, LNM_EvFdCb cb, void *arg)
+{
+    struct epoll_event ev;
+    LNM_EvFd *slot = NULL;
+    int i;
+
+    for (i = 0; i < LNM_EV_MAX_FDS && slot == NULL; i++)
+    {
+        if (ev_fds[i].cb == NULL)
+        {
+            slot = &ev_fds[i];
+        }
+    }
+    if (slot == NULL || cb == NULL)
+    {
+        LanManagerError(("%s: cannot watch fd %d\n", __FUNCTION__, fd));
+        return -1;
+    }
+    memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.ptr = slot;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0)
+    {
+        LanManagerError(("%s: epoll_ctl add fd %d failed, errno=%d\n", __FUNCTION__, fd, errno));
+        return -1;
+    }
+    slot->fd = fd;
+    slot->cb = cb;
+    slot->arg = arg;
+    return 0;
+}
+
+void LNM_EvLoopDelFd(int fd)
+{
+    LNM_EvFd *slot = EvLoop_FindFd(fd);
+
+    if (slot != NULL)
+    {
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+        slot->cb = NULL;
+        slot->arg = NULL;
+        slot->fd = -1;
+    }
+}
+
+int LNM_EvLoopAddTimer(unsigned int delay_ms, LNM_EvTimerCb cb, void *arg)
+{
+    int i, id;
+
+    pthread_mutex_lock(&timer_lock);
+    for (i = 0; i < LNM_EV_MAX_TIMERS; i++)
+    {
+        if (ev_timers[i].cb == NULL)
+        {
+            id = next_timer_id;
+            ev_timers[i].id = next_timer_id++;
+            if (next_timer_id <= 0)
+            {
+                next_timer_id = 1;
+            }
+            /* a zero deadline means "disarmed" to the timerfd, never use it */
+            ev_timers[i].deadline_ms = LNM_MonotonicMs() + (delay_ms ? delay_ms : 1);
+            ev_timers[i].cb = cb;
+            ev_timers[i].arg = arg;
+            EvLoop_RearmTimer();
+            pthread_mutex_unlock(&timer_lock);
+            return id;
+        }
+    }
+    pthread_mutex_unlock(&timer_lock);
+    LanManagerError(("%s: timer table full\n", __FUNCTION__));
+    return -1;
+}
+
+void LNM_EvLoopCancelTimer(int id)
+{
+    int i;
+
+    pthread_mutex_lock(&timer_lock);
+    for (i = 0; i < LNM_EV_MAX_TIMERS; i++)
+    {
+        if (ev_timers[i].cb != NULL && ev_timers[i].id == id)
+        {
+            ev_timers[i].cb = NULL;
+            EvLoop_RearmTimer();
+            break;
+        }
+    }
+    pthread_mutex_unlock(&timer_lock);
+}
+
+int LNM_EvLoopAddSignal(int signo, LNM_EvSignalCb cb, void *arg)
+{
+    int fd;
+
+    if (signo <= 0 || signo >= _NSIG)
+    {
+        return -1;
+    }
+    sigaddset(&signal_mask, signo);
+    if (sigprocmask(SIG_BLOCK, &signal_mask, NULL) < 0)
+    {
+        LanManagerError(("%s: sigprocmask failed, errno=%d\n", __FUNCTION__, errno));
+        return -1;
+    }
+    fd = signalfd(signal_fd, &signal_mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (fd < 0)
+    {
+        LanManagerError(("%s: signalfd failed, errno=%d\n", __FUNCTION__, errno));
+        return -1;
+    }
+    ev_signals[signo].cb = cb;
+    ev_signals[signo].arg = arg;
+    if (signal_fd < 0)
+    {
+        signal_fd = fd;
+        return LNM_EvLoopAddFd(signal_fd, EPOLLIN, EvLoop_SignalReceived, NULL);
+    }
+    return 0;
+}
+
+int LNM_EvLoopRun(void)
+{
+    struct epoll_event events[LNM_EV_MAX_EVENTS];
+    int n, i;
+
+    loop_running = 1;
+    while (loop_running)
+    {
+        n = epoll_wait(epoll_fd, events, LNM_EV_MAX_EVENTS, -1);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            LanManagerError(("%s: epoll_wait failed, errno=%d\n", __FUNCTION__, errno));
+            return -1;
+        }
+        for (i = 0; i < n; i++)
+        {
+            LNM_EvFd *slot = events[i].data.ptr;
+            /* the slot may have been released by an earlier callback */
+            if (slot->cb != NULL)
+            {
+                slot->cb(slot->fd, events[i].events, slot->arg);
+            }
+        }
+    }
+    return 0;
+}
+
+void LNM_EvLoopStop(void)
+{
+    loop_running = 0;
+}
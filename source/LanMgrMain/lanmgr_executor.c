@@ -0,0 +1,344 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <string.h>
+#include "lanmgr_evloop.h"
+#include "lanmgr_executor.h"
+#include "lanmgr_footprint.h"
+#include "lanmgr_log.h"
+#include "lanmgr_stats.h"
+#include "lanmgr_watchdog.h"
+
+typedef enum
+{
+    EXEC_EVENT,
+    EXEC_CALL,
+    EXEC_STOP
+} eExecItemType;
+
+typedef struct
+{
+    eExecItemType  type;
+    LNM_ExecFn     fn;
+    void          *arg;
+    uint64_t       enqueue_us;
+    char           name[64];
+    char           val[64];
+} LNM_ExecItem;
+
+typedef struct
+{
+    LNM_ExecFn  fn;
+    void       *arg;
+    int         in_use;
+} LNM_ExecTimer;
+
+/* Single producer (the loop) / single consumer (the executor) ring. The
+ * semaphores count queued items and free slots; head and tail are only
+ * ever written by their own side. */
+static LNM_ExecItem ring[LNM_EXEC_QUEUE_DEPTH];
+static unsigned int head;
+static unsigned int tail;
+static sem_t items_sem;
+static sem_t space_sem;
+static pthread_t exec_tid;
+static int exec_running = 0;
+static LNM_ExecEventFn dispatch_fn = NULL;
+/* on the statistics page; each field but depth has a single writer, the
+ * loop for the receive stage and the executor for its own */
+static LNM_ExecutorStats *stats;
+
+static pthread_mutex_t timer_lock = PTHREAD_MUTEX_INITIALIZER;
+static LNM_ExecTimer timers[LNM_EV_MAX_TIMERS];
+
+static void Executor_Run(LNM_ExecItem *item)
+{
+    if (item->type == EXEC_EVENT)
+    {
+        if (dispatch_fn != NULL)
+        {
+            dispatch_fn(item->name, item->val);
+        }
+    }
+    else if (item->fn != NULL)
+    {
+        /* event handlers are watched by the dispatcher with their own deadline */
+        LNM_WatchdogBegin("task", 0);
+        item->fn(item->arg);
+        LNM_WatchdogEnd();
+    }
+}
+
+static void Executor_Account(uint64_t enqueue_us, uint64_t start_us, uint64_t end_us)
+{
+    uint32_t wait = (uint32_t)(start_us - enqueue_us);
+    uint32_t run = (uint32_t)(end_us - start_us);
+    uint32_t v = wait;
+    int bucket = 0;
+
+    while (v != 0 && bucket < LNM_EXEC_WAIT_BUCKETS - 1)
+    {
+        v >>= 1;
+        bucket++;
+    }
+    __atomic_fetch_add(&stats->wait_buckets[bucket], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->sum_wait_us, wait, __ATOMIC_RELAXED);
+    if (wait > __atomic_load_n(&stats->max_wait_us, __ATOMIC_RELAXED))
+    {
+        __atomic_store_n(&stats->max_wait_us, wait, __ATOMIC_RELAXED);
+    }
+    if (run > __atomic_load_n(&stats->max_run_us, __ATOMIC_RELAXED))
+    {
+        __atomic_store_n(&stats->max_run_us, run, __ATOMIC_RELAXED);
+    }
+    __atomic_fetch_add(&stats->executed, 1, __ATOMIC_RELAXED);
+}
+
+static void *Executor_Thread(void *arg)
+{
+    LNM_WatchdogRegister("executor");
+    for (;;)
+    {
+        unsigned int t;
+        LNM_ExecItem *item;
+        uint64_t start_us;
+
+        while (sem_wait(&items_sem) != 0 && errno == EINTR)
+        {
+        }
+        t = __atomic_load_n(&tail, __ATOMIC_RELAXED);
+        item = &ring[t & (LNM_EXEC_QUEUE_DEPTH - 1)];
+        if (item->type == EXEC_STOP)
+        {
+            __atomic_store_n(&tail, t + 1, __ATOMIC_RELEASE);
+            break;
+        }
+        start_us = LNM_MonotonicUs();
+        Executor_Run(item);
+        Executor_Account(item->enqueue_us, start_us, LNM_MonotonicUs());
+        __atomic_store_n(&tail, t + 1, __ATOMIC_RELEASE);
+        __atomic_fetch_sub(&stats->depth, 1, __ATOMIC_RELAXED);
+        sem_post(&space_sem);
+    }
+    return NULL;
+}
+
+static void Executor_Enqueue(const LNM_ExecItem *src)
+{
+    unsigned int h, depth;
+    LNM_ExecItem *item;
+
+    if (sem_trywait(&space_sem) != 0)
+    {
+        /* backlog: hold the loop until the executor frees a slot */
+        __atomic_fetch_add(&stats->stalls, 1, __ATOMIC_RELAXED);
+        while (sem_wait(&space_sem) != 0 && errno == EINTR)
+        {
+        }
+    }
+    h = __atomic_load_n(&head, __ATOMIC_RELAXED);
+    item = &ring[h & (LNM_EXEC_QUEUE_DEPTH - 1)];
+    *item = *src;
+    item->enqueue_us = LNM_MonotonicUs();
+    /* counted before the executor can see it, so depth never drops below 0 */
+    depth = __atomic_add_fetch(&stats->depth, 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&head, h + 1, __ATOMIC_RELEASE);
+    sem_post(&items_sem);
+
+    __atomic_fetch_add(&stats->posted, 1, __ATOMIC_RELAXED);
+    if (depth > __atomic_load_n(&stats->max_depth, __ATOMIC_RELAXED))
+    {
+        __atomic_store_n(&stats->max_depth, depth, __ATOMIC_RELAXED);
+        /* report each doubling of the backlog, not every new maximum */
+        if (depth >= 8 && (depth & (depth - 1)) == 0)
+        {
+            LanManagerWarn((" executor backlog reached %u events \n", depth));
+        }
+    }
+}
+
+int LNM_ExecutorInit(LNM_ExecEventFn dispatch)
+{
+    dispatch_fn = dispatch;
+    head = 0;
+    tail = 0;
+    /* the page is in place by now, LNM_StatsInit() runs first */
+    stats = LNM_StatsExecutor();
+    memset(stats, 0, sizeof(*stats));
+    if (sem_init(&items_sem, 0, 0) != 0)
+    {
+        return -1;
+    }
+    /* one slot is kept back for the stop marker */
+    if (sem_init(&space_sem, 0, LNM_EXEC_QUEUE_DEPTH - 1) != 0)
+    {
+        sem_destroy(&items_sem);
+        return -1;
+    }
+    if (LNM_ThreadCreate(&exec_tid, Executor_Thread, NULL) != 0)
+    {
+        LanManagerError(("%s: executor thread create failed\n", __FUNCTION__));
+        sem_destroy(&items_sem);
+        sem_destroy(&space_sem);
+        return -1;
+    }
+    exec_running = 1;
+    return 0;
+}
+
+void LNM_ExecutorStop(void)
+{
+    unsigned int h;
+
+    if (!exec_running)
+    {
+        return;
+    }
+    h = __atomic_load_n(&head, __ATOMIC_RELAXED);
+    ring[h & (LNM_EXEC_QUEUE_DEPTH - 1)].type = EXEC_STOP;
+    __atomic_store_n(&head, h + 1, __ATOMIC_RELEASE);
+    sem_post(&items_sem);
+    pthread_join(exec_tid, NULL);
+    exec_running = 0;
+    sem_destroy(&items_sem);
+    sem_destroy(&space_sem);
+}
+
+void LNM_ExecutorPostEvent(const char *name, const char *val)
+{
+    LNM_ExecItem item;
+
+    if (!exec_running)
+    {
+        if (dispatch_fn != NULL)
+        {
+            dispatch_fn(name, val);
+        }
+        return;
+    }
+    item.type = EXEC_EVENT;
+    item.fn = NULL;
+    item.arg = NULL;
+    snprintf(item.name, sizeof(item.name), "%s", name);
+    snprintf(item.val, sizeof(item.val), "%s", val);
+    Executor_Enqueue(&item);
+}
+
+void LNM_ExecutorPost(LNM_ExecFn fn, void *arg)
+{
+    LNM_ExecItem item;
+
+    if (!exec_running)
+    {
+        fn(arg);
+        return;
+    }
+    item.type = EXEC_CALL;
+    item.fn = fn;
+    item.arg = arg;
+    item.name[0] = '\0';
+    item.val[0] = '\0';
+    Executor_Enqueue(&item);
+}
+
+int LNM_ExecutorOnThread(void)
+{
+    return !exec_running || pthread_equal(pthread_self(), exec_tid);
+}
+
+/* Loop side of an executor timer: free the slot and hand the call over. */
+static void Executor_TimerFired(void *arg)
+{
+    LNM_ExecTimer *t = arg;
+    LNM_ExecFn fn;
+    void *fn_arg;
+
+    pthread_mutex_lock(&timer_lock);
+    fn = t->fn;
+    fn_arg = t->arg;
+    t->in_use = 0;
+    pthread_mutex_unlock(&timer_lock);
+    LNM_ExecutorPost(fn, fn_arg);
+}
+
+int LNM_ExecutorAddTimer(unsigned int delay_ms, LNM_ExecFn fn, void *arg)
+{
+    LNM_ExecTimer *t = NULL;
+    int i, id;
+
+    pthread_mutex_lock(&timer_lock);
+    for (i = 0; i < LNM_EV_MAX_TIMERS && t == NULL; i++)
+    {
+        if (!timers[i].in_use)
+        {
+            t = &timers[i];
+            t->in_use = 1;
+            t->fn = fn;
+            t->arg = arg;
+        }
+    }
+    pthread_mutex_unlock(&timer_lock);
+    if (t == NULL)
+    {
+        LanManagerError(("%s: timer table full\n", __FUNCTION__));
+        return -1;
+    }
+    id = LNM_EvLoopAddTimer(delay_ms, Executor_TimerFired, t);
+    if (id < 0)
+    {
+        pthread_mutex_lock(&timer_lock);
+        t->in_use = 0;
+        pthread_mutex_unlock(&timer_lock);
+    }
+    return id;
+}
+
+void LNM_ExecutorGetStats(LNM_ExecutorStats *out)
+{
+    const LNM_ExecutorStats *s = LNM_StatsExecutor();
+    int i;
+
+    out->posted = __atomic_load_n(&s->posted, __ATOMIC_RELAXED);
+    out->depth = __atomic_load_n(&s->depth, __ATOMIC_RELAXED);
+    out->max_depth = __atomic_load_n(&s->max_depth, __ATOMIC_RELAXED);
+    out->stalls = __atomic_load_n(&s->stalls, __ATOMIC_RELAXED);
+    out->executed = __atomic_load_n(&s->executed, __ATOMIC_RELAXED);
+    out->max_wait_us = __atomic_load_n(&s->max_wait_us, __ATOMIC_RELAXED);
+    out->sum_wait_us = __atomic_load_n(&s->sum_wait_us, __ATOMIC_RELAXED);
+    out->max_run_us = __atomic_load_n(&s->max_run_us, __ATOMIC_RELAXED);
+    for (i = 0; i < LNM_EXEC_WAIT_BUCKETS; i++)
+    {
+        out->wait_buckets[i] = __atomic_load_n(&s->wait_buckets[i], __ATOMIC_RELAXED);
+    }
+}
+
+void LNM_ExecutorDump(void)
+{
+    LNM_ExecutorStats s;
+
+    LNM_ExecutorGetStats(&s);
+    LanManagerInfo((" executor: posted=%llu executed=%llu max_depth=%u stalls=%llu wait avg=%llu max=%u us, max run=%u us \n",
+                    (unsigned long long)s.posted, (unsigned long long)s.executed, s.max_depth,
+                    (unsigned long long)s.stalls,
+                    (unsigned long long)(s.executed ? s.sum_wait_us / s.executed : 0),
+                    s.max_wait_us, s.max_run_us));
+}
@@ -0,0 +1,231 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#include <telemetry_busmessage_sender.h>
+#include "lanmgr_evloop.h"
+#include "lanmgr_footprint.h"
+#include "lanmgr_log.h"
+
+static int low_footprint = 0;
+static uint64_t main_ms = 0;
+static int reported = 0;
+static uint32_t baseline_heap_kb = 0;
+static uint32_t heap_peak_kb = 0;
+/* /proc files are read with plain read(), stdio would allocate */
+static char proc_buf[4096];
+
+static const char *Footprint_ReadProc(const char *path)
+{
+    ssize_t len;
+    int fd;
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+    len = read(fd, proc_buf, sizeof(proc_buf) - 1);
+    close(fd);
+    if (len <= 0)
+    {
+        return NULL;
+    }
+    proc_buf[len] = '\0';
+    return proc_buf;
+}
+
+static uint32_t Footprint_StatusKb(const char *status, const char *key)
+{
+    const char *p = strstr(status, key);
+
+    return p != NULL ? (uint32_t)strtoul(p + strlen(key), NULL, 10) : 0;
+}
+
+/* Milliseconds since the kernel started the process, from the start time
+ * in /proc/self/stat, which has clock tick resolution. */
+static int Footprint_ExecMs(uint32_t *ms)
+{
+    const char *p = Footprint_ReadProc("/proc/self/stat");
+    unsigned long long start_ticks;
+    struct timespec now;
+    long hz = sysconf(_SC_CLK_TCK);
+    int field;
+
+    /* the command name may hold spaces, fields are counted after it */
+    p = p != NULL ? strrchr(p, ')') : NULL;
+    if (p == NULL || hz <= 0 || clock_gettime(CLOCK_BOOTTIME, &now) != 0)
+    {
+        return -1;
+    }
+    for (field = 2; field < 22 && p != NULL; field++)
+    {
+        p = strchr(p + 1, ' ');
+    }
+    if (p == NULL)
+    {
+        return -1;
+    }
+    start_ticks = strtoull(p + 1, NULL, 10);
+    *ms = (uint32_t)((uint64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000 - start_ticks * 1000 / hz);
+    return 0;
+}
+
+void LNM_FootprintInit(int low)
+{
+    main_ms = LNM_MonotonicMs();
+    low_footprint = low;
+    if (!low_footprint)
+    {
+        return;
+    }
+#if defined(__GLIBC__)
+    /* one arena for all threads, and the heap only ever grows, so the
+     * memory obtained from the system is also the peak */
+    mallopt(M_ARENA_MAX, 1);
+    mallopt(M_MMAP_MAX, 0);
+    mallopt(M_TRIM_THRESHOLD, -1);
+#endif
+    setvbuf(stdout, NULL, _IONBF, 0);
+}
+
+int LNM_FootprintLow(void)
+{
+    return low_footprint;
+}
+
+int LNM_FootprintLock(void)
+{
+    if (!low_footprint)
+    {
+        return 0;
+    }
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        LanManagerError((" mlockall failed, errno=%d, memory is not locked \n", errno));
+        return -1;
+    }
+    LanManagerInfo((" low footprint mode, memory locked \n"));
+    return 0;
+}
+
+int LNM_ThreadCreate(pthread_t *tid, void *(*fn)(void *), void *arg)
+{
+    pthread_attr_t attr;
+    size_t stack = LNM_THREAD_STACK_SIZE;
+    int rc;
+
+    if (stack < PTHREAD_STACK_MIN)
+    {
+        stack = PTHREAD_STACK_MIN;
+    }
+    rc = pthread_attr_init(&attr);
+    if (rc != 0)
+    {
+        return rc;
+    }
+    rc = pthread_attr_setstacksize(&attr, stack);
+    if (rc == 0)
+    {
+        rc = pthread_create(tid, &attr, fn, arg);
+    }
+    pthread_attr_destroy(&attr);
+    return rc;
+}
+
+void LNM_FootprintSample(LNM_Footprint *fp)
+{
+    const char *status = Footprint_ReadProc("/proc/self/status");
+
+    memset(fp, 0, sizeof(*fp));
+    if (status != NULL)
+    {
+        fp->rss_kb = Footprint_StatusKb(status, "VmRSS:");
+        fp->rss_peak_kb = Footprint_StatusKb(status, "VmHWM:");
+        fp->locked_kb = Footprint_StatusKb(status, "VmLck:");
+    }
+#if defined(__GLIBC__)
+    {
+#if __GLIBC_PREREQ(2, 33)
+        struct mallinfo2 mi = mallinfo2();
+#else
+        struct mallinfo mi = mallinfo();
+#endif
+        uint32_t sys_kb = (uint32_t)(((size_t)mi.arena + (size_t)mi.hblkhd) / 1024);
+
+        fp->heap_kb = (uint32_t)(((size_t)mi.uordblks + (size_t)mi.hblkhd) / 1024);
+        /* sampled, exact in the low footprint mode where nothing is returned */
+        if (sys_kb > heap_peak_kb)
+        {
+            heap_peak_kb = sys_kb;
+        }
+        fp->heap_peak_kb = heap_peak_kb;
+    }
+#endif
+}
+
+void LNM_FootprintReport(void)
+{
+    LNM_Footprint fp;
+    uint32_t exec_ms = 0;
+    uint32_t ready_ms = (uint32_t)(LNM_MonotonicMs() - main_ms);
+
+    if (reported)
+    {
+        return;
+    }
+    reported = 1;
+    LNM_FootprintSample(&fp);
+    baseline_heap_kb = fp.heap_kb;
+    if (Footprint_ExecMs(&exec_ms) != 0)
+    {
+        /* without /proc, main is the closest known point */
+        exec_ms = ready_ms;
+    }
+    LanManagerInfo((" notifications registered %u ms after exec (%u ms after main): "
+                    "rss %u KiB, peak rss %u KiB, locked %u KiB, heap %u KiB, peak heap %u KiB \n",
+                    exec_ms, ready_ms, fp.rss_kb, fp.rss_peak_kb, fp.locked_kb, fp.heap_kb, fp.heap_peak_kb));
+    t2_event_d("lnm_exec_to_ready_split", (int)exec_ms);
+    t2_event_d("lnm_rss_kb_split", (int)fp.rss_kb);
+    t2_event_d("lnm_heap_peak_kb_split", (int)fp.heap_peak_kb);
+}
+
+void LNM_FootprintDump(void)
+{
+    LNM_Footprint fp;
+
+    LNM_FootprintSample(&fp);
+    LanManagerInfo((" footprint: rss %u KiB, peak rss %u KiB, locked %u KiB, heap %u KiB, peak heap %u KiB \n",
+                    fp.rss_kb, fp.rss_peak_kb, fp.locked_kb, fp.heap_kb, fp.heap_peak_kb));
+    if (reported && fp.heap_kb > baseline_heap_kb)
+    {
+        LanManagerWarn((" heap grew by %u KiB after the notifications were registered \n",
+                        fp.heap_kb - baseline_heap_kb));
+    }
+}
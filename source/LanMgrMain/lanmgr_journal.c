@@ -0,0 +1,107 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "lanmgr_journal.h"
+#include "lanmgr_log.h"
+
+static LNM_JournalFile *journal = NULL;
+
+static void Journal_Copy(char *dst, size_t size, const char *src)
+{
+    size_t n = src != NULL ? strnlen(src, size - 1) : 0;
+
+    if (n != 0)
+    {
+        memcpy(dst, src, n);
+    }
+    dst[n] = '\0';
+}
+
+int LNM_JournalInit(const char *path)
+{
+    struct stat st;
+    LNM_JournalFile *j;
+    int fd, valid;
+
+    fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        LanManagerError((" cannot open %s, errno=%d, events are not journaled \n", path, errno));
+        return -1;
+    }
+    /* umask must not hide the journal from unprivileged readers */
+    fchmod(fd, 0644);
+    valid = fstat(fd, &st) == 0 && st.st_size == (off_t)sizeof(LNM_JournalFile);
+    if (!valid && ftruncate(fd, sizeof(LNM_JournalFile)) != 0)
+    {
+        LanManagerError((" cannot size %s, errno=%d, events are not journaled \n", path, errno));
+        close(fd);
+        return -1;
+    }
+    j = mmap(NULL, sizeof(LNM_JournalFile), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (j == MAP_FAILED)
+    {
+        LanManagerError((" cannot map %s, errno=%d, events are not journaled \n", path, errno));
+        return -1;
+    }
+    if (!valid || j->magic != LNM_JOURNAL_MAGIC || j->version != LNM_JOURNAL_VERSION ||
+        j->record_size != sizeof(LNM_JournalRecord) || j->slots != LNM_JOURNAL_SLOTS)
+    {
+        memset(j, 0, sizeof(*j));
+        j->version = LNM_JOURNAL_VERSION;
+        j->record_size = sizeof(LNM_JournalRecord);
+        j->slots = LNM_JOURNAL_SLOTS;
+        /* readers check the magic last */
+        __atomic_store_n(&j->magic, LNM_JOURNAL_MAGIC, __ATOMIC_RELEASE);
+    }
+    journal = j;
+    LNM_JournalAppend(LNM_JOURNAL_START, "lan_manager", NULL, (int32_t)getpid());
+    return 0;
+}
+
+void LNM_JournalAppend(eLnmJournalType type, const char *name, const char *val, int32_t arg)
+{
+    LNM_JournalRecord *r;
+    struct timespec ts;
+    uint64_t idx;
+
+    if (journal == NULL)
+    {
+        return;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    idx = __atomic_fetch_add(&journal->head, 1, __ATOMIC_RELAXED);
+    r = &journal->records[idx & (LNM_JOURNAL_SLOTS - 1)];
+    /* invalidate the slot before its fields change */
+    __atomic_store_n(&r->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    r->ts_us = (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+    r->type = (uint8_t)type;
+    r->arg = arg;
+    Journal_Copy(r->name, sizeof(r->name), name);
+    Journal_Copy(r->val, sizeof(r->val), val);
+    __atomic_store_n(&r->seq, idx + 1, __ATOMIC_RELEASE);
+}
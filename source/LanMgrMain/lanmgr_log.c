@@ -16,11 +16,41 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
 */
+#include <stddef.h>
 #include <stdio.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include "lanmgr_footprint.h"
 #include "lanmgr_log.h"
+#include "lanmgr_stats.h"
 
+typedef struct
+{
+    atomic_size_t  seq;
+    int            level;
+    char           text[LNM_LOG_RECORD_SIZE];
+} LNM_LogRecord;
+
+int lanmgr_log_threshold = RDK_LOG_DEBUG;
+volatile int lanmgr_log_async = 0;
+
+/* Bounded multi-producer ring: a slot is free for the producer at position
+ * pos when its seq equals pos, and holds a record for the drainer when its
+ * seq equals pos + 1. */
+static LNM_LogRecord log_ring[LNM_LOG_RING_SLOTS];
+static atomic_size_t enqueue_pos;
+static size_t dequeue_pos;
+static atomic_ulong dropped;          /* since the last overflow report */
+static atomic_int producers;          /* inside LanManagerLogAsync() */
+static sem_t log_sem;
+static pthread_t drainer_tid;
+static atomic_int drainer_stop;
+static pthread_mutex_t bucket_lock = PTHREAD_MUTEX_INITIALIZER;
 
 /**
  * @brief LanManagerLogInit Initialize RDK Logger
@@ -28,19 +58,226 @@
 bool LanManagerLogInit()
 {
 #ifdef FEATURE_SUPPORT_RDKLOG
+    int level;
+
     if (rdk_logger_init(DEBUG_INI_NAME) != RDK_SUCCESS)
     {
         return false;
     }
+    /* cache the configured level so enabled records need no lookup */
+    lanmgr_log_threshold = RDK_LOG_FATAL;
+    for (level = RDK_LOG_DEBUG; level > RDK_LOG_FATAL; level--)
+    {
+        if (rdk_dbg_enabled(LANMANAGER_LOG_MODULE, (rdk_LogLevel)level))
+        {
+            lanmgr_log_threshold = level;
+            break;
+        }
+    }
 #endif
 
     return true;
 }
 
+bool LanManagerLogRecheck(int level)
+{
+#ifdef FEATURE_SUPPORT_RDKLOG
+    /* the cache only ever rises: a level lowered later is still filtered
+     * by rdk_logger, after formatting */
+    if (rdk_dbg_enabled(LANMANAGER_LOG_MODULE, (rdk_LogLevel)level))
+    {
+        if (level > lanmgr_log_threshold)
+        {
+            lanmgr_log_threshold = level;
+        }
+        return true;
+    }
+#endif
+    return false;
+}
+
 bool LanManagerLogDeinit()
 {
+    LanManagerLogAsyncStop();
 #ifdef FEATURE_SUPPORT_RDKLOG
     return (rdk_logger_deinit() == RDK_SUCCESS ? true : false);
 #endif
+    return true;
+}
+
+void LanManagerLogAsync(int level, const char *format, ...)
+{
+    size_t pos;
+    LNM_LogRecord *r;
+    va_list args;
+
+    /* announce ourselves before looking at the mode: once the stopper saw
+     * no producer, everyone after it sees synchronous mode */
+    atomic_fetch_add(&producers, 1);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!lanmgr_log_async)
+    {
+        char text[LNM_LOG_RECORD_SIZE];
+
+        va_start(args, format);
+        vsnprintf(text, sizeof(text), format, args);
+        va_end(args);
+        RDK_LOG(level, LANMANAGER_LOG_MODULE, "%s", text);
+        atomic_fetch_sub(&producers, 1);
+        return;
+    }
+    pos = atomic_load_explicit(&enqueue_pos, memory_order_relaxed);
+    for (;;)
+    {
+        size_t seq;
+
+        r = &log_ring[pos & (LNM_LOG_RING_SLOTS - 1)];
+        seq = atomic_load_explicit(&r->seq, memory_order_acquire);
+        if (seq == pos)
+        {
+            if (atomic_compare_exchange_weak_explicit(&enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if ((ptrdiff_t)(seq - pos) < 0)
+        {
+            /* ring full: the drainer is behind, never wait for it */
+            atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+            LNM_StatsInc(LNM_STAT_LOG_DROPPED);
+            atomic_fetch_sub(&producers, 1);
+            return;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&enqueue_pos, memory_order_relaxed);
+        }
+    }
+    r->level = level;
+    va_start(args, format);
+    vsnprintf(r->text, sizeof(r->text), format, args);
+    va_end(args);
+    atomic_store_explicit(&r->seq, pos + 1, memory_order_release);
+    sem_post(&log_sem);
+    atomic_fetch_sub(&producers, 1);
+}
+
+static void LanManagerLog_Drain(void)
+{
+    unsigned long lost;
+
+    for (;;)
+    {
+        LNM_LogRecord *r = &log_ring[dequeue_pos & (LNM_LOG_RING_SLOTS - 1)];
+
+        if (atomic_load_explicit(&r->seq, memory_order_acquire) != dequeue_pos + 1)
+        {
+            break;
+        }
+        RDK_LOG(r->level, LANMANAGER_LOG_MODULE, "%s", r->text);
+        atomic_store_explicit(&r->seq, dequeue_pos + LNM_LOG_RING_SLOTS, memory_order_release);
+        dequeue_pos++;
+    }
+    lost = atomic_exchange_explicit(&dropped, 0, memory_order_relaxed);
+    if (lost != 0)
+    {
+        RDK_LOG(RDK_LOG_WARN, LANMANAGER_LOG_MODULE, "log ring overflow, %lu record(s) dropped\n", lost);
+    }
 }
 
+static void *LanManagerLog_Drainer(void *arg)
+{
+    while (!atomic_load(&drainer_stop))
+    {
+        sem_wait(&log_sem);
+        LanManagerLog_Drain();
+    }
+    LanManagerLog_Drain();
+    return NULL;
+}
+
+bool LanManagerLogAsyncStart(void)
+{
+    size_t i;
+
+    if (lanmgr_log_async)
+    {
+        return true;
+    }
+    for (i = 0; i < LNM_LOG_RING_SLOTS; i++)
+    {
+        atomic_store(&log_ring[i].seq, i);
+    }
+    atomic_store(&enqueue_pos, 0);
+    dequeue_pos = 0;
+    atomic_store(&drainer_stop, 0);
+    if (sem_init(&log_sem, 0, 0) != 0)
+    {
+        return false;
+    }
+    if (LNM_ThreadCreate(&drainer_tid, LanManagerLog_Drainer, NULL) != 0)
+    {
+        sem_destroy(&log_sem);
+        return false;
+    }
+    lanmgr_log_async = 1;
+    return true;
+}
+
+void LanManagerLogAsyncStop(void)
+{
+    if (!lanmgr_log_async)
+    {
+        return;
+    }
+    /* producers that already saw async mode finish into the ring and post
+     * log_sem before the drainer's final pass and the sem_destroy() */
+    lanmgr_log_async = 0;
+    atomic_thread_fence(memory_order_seq_cst);
+    while (atomic_load(&producers) != 0)
+    {
+        sched_yield();
+    }
+    atomic_store(&drainer_stop, 1);
+    sem_post(&log_sem);
+    pthread_join(drainer_tid, NULL);
+    sem_destroy(&log_sem);
+}
+
+bool LanManagerLogAllow(LNM_LogBucket *bucket, unsigned int burst, unsigned int interval_ms,
+                        unsigned int *suppressed)
+{
+    struct timespec ts;
+    uint64_t now, periods;
+    bool allow = false;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    now = (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+    pthread_mutex_lock(&bucket_lock);
+    if (bucket->refill_ms == 0)
+    {
+        bucket->tokens = burst;
+        bucket->refill_ms = now;
+    }
+    else if (interval_ms != 0 && now - bucket->refill_ms >= interval_ms)
+    {
+        /* whole intervals only, the remainder counts towards the next token */
+        periods = (now - bucket->refill_ms) / interval_ms;
+        bucket->refill_ms += periods * interval_ms;
+        bucket->tokens = periods >= burst - bucket->tokens ? burst : bucket->tokens + (unsigned int)periods;
+    }
+    if (bucket->tokens != 0)
+    {
+        bucket->tokens--;
+        *suppressed = bucket->suppressed;
+        bucket->suppressed = 0;
+        allow = true;
+    }
+    else
+    {
+        bucket->suppressed++;
+    }
+    pthread_mutex_unlock(&bucket_lock);
+    return allow;
+}
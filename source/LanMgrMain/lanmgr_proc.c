@@ -0,0 +1,234 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "lanmgr_evloop.h"
+#include "lanmgr_log.h"
+#include "lanmgr_proc.h"
+#include "lanmgr_stats.h"
+
+extern char **environ;
+
+typedef struct
+{
+    int           in_use;
+    char          name[32];
+    char         *argv[LNM_PROC_MAX_ARGS + 1];   /* into args */
+    char          args[LNM_PROC_ARGS_SIZE];
+    pid_t         pid;              /* 0 while not running */
+    uint64_t      started_ms;
+    unsigned int  backoff_ms;
+    int           restart_timer;
+} LNM_Proc;
+
+static LNM_Proc procs[LNM_PROC_MAX];
+static pthread_mutex_t proc_lock = PTHREAD_MUTEX_INITIALIZER;
+static int stopping = 0;
+
+static void Proc_Restart(void *arg);
+
+/* Called with proc_lock held. */
+static int Proc_Spawn(LNM_Proc *p)
+{
+    posix_spawnattr_t attr;
+    sigset_t mask;
+    int rc;
+
+    /* the child must not inherit the mask the loop blocks for signalfd,
+     * nor the SIGPIPE we ignore */
+    posix_spawnattr_init(&attr);
+    sigemptyset(&mask);
+    posix_spawnattr_setsigmask(&attr, &mask);
+    sigaddset(&mask, SIGPIPE);
+    sigaddset(&mask, SIGCHLD);
+    posix_spawnattr_setsigdefault(&attr, &mask);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF);
+    rc = posix_spawn(&p->pid, p->argv[0], NULL, &attr, p->argv, environ);
+    posix_spawnattr_destroy(&attr);
+    if (rc != 0)
+    {
+        p->pid = 0;
+        LanManagerErrorRL((" cannot start %s (%s), errno=%d \n", p->name, p->argv[0], rc));
+        return -1;
+    }
+    p->started_ms = LNM_MonotonicMs();
+    LanManagerInfo((" started %s, pid %d \n", p->name, (int)p->pid));
+    return 0;
+}
+
+/* Called with proc_lock held. */
+static void Proc_ScheduleRestart(LNM_Proc *p)
+{
+    if (stopping || p->restart_timer > 0)
+    {
+        return;
+    }
+    if (p->backoff_ms == 0)
+    {
+        p->backoff_ms = LNM_PROC_BACKOFF_MIN_MSECS;
+    }
+    LanManagerInfo((" restarting %s in %u ms \n", p->name, p->backoff_ms));
+    p->restart_timer = LNM_EvLoopAddTimer(p->backoff_ms, Proc_Restart, p);
+    p->backoff_ms *= 2;
+    if (p->backoff_ms > LNM_PROC_BACKOFF_MAX_MSECS)
+    {
+        p->backoff_ms = LNM_PROC_BACKOFF_MAX_MSECS;
+    }
+}
+
+static void Proc_Restart(void *arg)
+{
+    LNM_Proc *p = arg;
+
+    pthread_mutex_lock(&proc_lock);
+    p->restart_timer = -1;
+    if (!stopping && p->pid == 0)
+    {
+        LNM_StatsInc(LNM_STAT_PROC_RESTARTS);
+        if (Proc_Spawn(p) != 0)
+        {
+            Proc_ScheduleRestart(p);
+        }
+    }
+    pthread_mutex_unlock(&proc_lock);
+}
+
+static void Proc_ChildExited(int signo, void *arg)
+{
+    uint64_t now = LNM_MonotonicMs();
+    int i, status;
+
+    pthread_mutex_lock(&proc_lock);
+    for (i = 0; i < LNM_PROC_MAX; i++)
+    {
+        LNM_Proc *p = &procs[i];
+
+        /* SIGCHLD coalesces, poll every helper; never waitpid(-1) */
+        if (!p->in_use || p->pid == 0 || waitpid(p->pid, &status, WNOHANG) != p->pid)
+        {
+            continue;
+        }
+        if (WIFSIGNALED(status))
+        {
+            LanManagerWarn((" %s (pid %d) killed by signal %d \n", p->name, (int)p->pid, WTERMSIG(status)));
+        }
+        else
+        {
+            LanManagerWarn((" %s (pid %d) exited with %d \n", p->name, (int)p->pid, WEXITSTATUS(status)));
+        }
+        p->pid = 0;
+        if (now - p->started_ms >= LNM_PROC_STABLE_MSECS)
+        {
+            p->backoff_ms = 0;
+        }
+        Proc_ScheduleRestart(p);
+    }
+    pthread_mutex_unlock(&proc_lock);
+}
+
+int LNM_ProcInit(void)
+{
+    return LNM_EvLoopAddSignal(SIGCHLD, Proc_ChildExited, NULL);
+}
+
+int LNM_ProcStart(const char *name, char *const argv[])
+{
+    LNM_Proc *p = NULL;
+    size_t len;
+    int i;
+
+    pthread_mutex_lock(&proc_lock);
+    for (i = 0; i < LNM_PROC_MAX; i++)
+    {
+        if (procs[i].in_use && strcmp(procs[i].name, name) == 0)
+        {
+            pthread_mutex_unlock(&proc_lock);
+            return 1;
+        }
+        if (!procs[i].in_use && p == NULL)
+        {
+            p = &procs[i];
+        }
+    }
+    if (stopping || p == NULL || argv == NULL || argv[0] == NULL)
+    {
+        pthread_mutex_unlock(&proc_lock);
+        LanManagerError((" cannot supervise %s \n", name));
+        return -1;
+    }
+    memset(p, 0, sizeof(*p));
+    p->in_use = 1;
+    p->restart_timer = -1;
+    snprintf(p->name, sizeof(p->name), "%s", name);
+    for (i = 0, len = 0; i < LNM_PROC_MAX_ARGS && argv[i] != NULL; i++)
+    {
+        size_t n = strlen(argv[i]) + 1;
+
+        if (len + n > sizeof(p->args))
+        {
+            LanManagerWarn((" %s: arguments from %s on dropped, over %u bytes \n", name, argv[i],
+                            (unsigned int)sizeof(p->args)));
+            break;
+        }
+        p->argv[i] = memcpy(&p->args[len], argv[i], n);
+        len += n;
+    }
+    if (p->argv[0] == NULL)
+    {
+        p->in_use = 0;
+        pthread_mutex_unlock(&proc_lock);
+        LanManagerError((" cannot supervise %s \n", name));
+        return -1;
+    }
+    if (Proc_Spawn(p) != 0)
+    {
+        Proc_ScheduleRestart(p);
+    }
+    pthread_mutex_unlock(&proc_lock);
+    return 0;
+}
+
+void LNM_ProcStopAll(void)
+{
+    int i;
+
+    pthread_mutex_lock(&proc_lock);
+    stopping = 1;
+    for (i = 0; i < LNM_PROC_MAX; i++)
+    {
+        if (procs[i].in_use && procs[i].restart_timer > 0)
+        {
+            LNM_EvLoopCancelTimer(procs[i].restart_timer);
+            procs[i].restart_timer = -1;
+        }
+        if (procs[i].in_use && procs[i].pid > 0)
+        {
+            LanManagerInfo((" stopping %s, pid %d \n", procs[i].name, (int)procs[i].pid));
+            kill(procs[i].pid, SIGTERM);
+        }
+    }
+    pthread_mutex_unlock(&proc_lock);
+}
@@ -0,0 +1,172 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lanmgr_journal.h"
+#include "lanmgr_log.h"
+#include "lanmgr_rules.h"
+#include "lanmgr_setq.h"
+#include "lanmgr_state.h"
+#include "lanmgr_syscfg.h"
+#include "lanmgr_sysevent.h"
+
+/* The profile the build was configured for. This is the only place the
+ * platform defines are looked at. */
+#if defined(INTEL_PUMA7) || defined(_COSA_BCM_MIPS_) || defined(_COSA_BCM_ARM_) || defined(_COSA_QCA_ARM_)
+#define PROFILE_PNM_STATUS  LNM_PROFILE_PNM_STATUS
+#else
+#define PROFILE_PNM_STATUS  0
+#endif
+#if defined(INTEL_PUMA7) || defined(_COSA_BCM_MIPS_) || defined(_COSA_BCM_ARM_) || defined(_COSA_INTEL_XB3_ARM_) || defined(_COSA_QCA_ARM_)
+#define PROFILE_EXT_HOTSPOT  LNM_PROFILE_EXT_HOTSPOT
+#else
+#define PROFILE_EXT_HOTSPOT  0
+#endif
+#ifdef MULTILAN_FEATURE
+#define PROFILE_MULTILAN  LNM_PROFILE_MULTILAN
+#else
+#define PROFILE_MULTILAN  0
+#endif
+#ifdef CONFIG_CISCO_HOME_SECURITY
+#define PROFILE_HOME_SECURITY  LNM_PROFILE_HOME_SECURITY
+#else
+#define PROFILE_HOME_SECURITY  0
+#endif
+#if defined(RDK_ONEWIFI) && (defined(_XB6_PRODUCT_REQ_) || defined(_WNXL11BWL_PRODUCT_REQ_))
+#define PROFILE_LNF  LNM_PROFILE_LNF
+#else
+#define PROFILE_LNF  0
+#endif
+#if defined(_RDKB_GLOBAL_PRODUCT_REQ_)
+#define PROFILE_LNF_SWITCH  LNM_PROFILE_LNF_SWITCH
+#else
+#define PROFILE_LNF_SWITCH  0
+#endif
+#ifdef CONFIG_CISCO_FEATURE_CISCOCONNECT
+#define PROFILE_CISCOCONNECT  LNM_PROFILE_CISCOCONNECT
+#else
+#define PROFILE_CISCOCONNECT  0
+#endif
+#ifdef DSLITE_FEATURE_SUPPORT
+#define PROFILE_DSLITE  LNM_PROFILE_DSLITE
+#else
+#define PROFILE_DSLITE  0
+#endif
+
+#define PROFILE_BUILD  (PROFILE_PNM_STATUS | PROFILE_EXT_HOTSPOT | PROFILE_MULTILAN | PROFILE_HOME_SECURITY | \
+                        PROFILE_LNF | PROFILE_LNF_SWITCH | PROFILE_CISCOCONNECT | PROFILE_DSLITE)
+
+static uint32_t profile = PROFILE_BUILD;
+static const LNM_Rule *active[LNM_RULES_MAX];
+static unsigned int first[LNM_RULE_TRIGGER_MAX + 1];   /* active[first[t], first[t + 1]) */
+
+uint32_t LNM_RulesInit(const LNM_Rule *rules, unsigned int num_rules)
+{
+    const char *override = LNM_SysCfgCacheGetStr(LNM_CFG_LAN_MANAGER_PROFILE);
+    char val[16];
+    unsigned int i, n = 0;
+    int t;
+
+    profile = PROFILE_BUILD;
+    if (override[0] != '\0')
+    {
+        profile = (uint32_t)strtoul(override, NULL, 0);
+        LanManagerInfo((" profile 0x%x from syscfg, build profile 0x%x \n", profile, PROFILE_BUILD));
+    }
+    /* a replay must run with this profile rather than its own build's */
+    snprintf(val, sizeof(val), "0x%x", profile);
+    LNM_JournalAppend(LNM_JOURNAL_CFG, "lan_manager_profile", val, 0);
+    for (t = 0; t < LNM_RULE_TRIGGER_MAX; t++)
+    {
+        first[t] = n;
+        for (i = 0; i < num_rules; i++)
+        {
+            if ((int)rules[i].trigger != t || !LNM_RulesProfileMatch(rules[i].require, rules[i].exclude))
+            {
+                continue;
+            }
+            if (n == LNM_RULES_MAX)
+            {
+                LanManagerError((" rule table full, %s is dropped \n", rules[i].set_name));
+                continue;
+            }
+            active[n++] = &rules[i];
+        }
+    }
+    first[LNM_RULE_TRIGGER_MAX] = n;
+    LanManagerInfo((" profile 0x%x, %u of %u rule(s) active \n", profile, n, num_rules));
+    return profile;
+}
+
+uint32_t LNM_RulesProfile(void)
+{
+    return profile;
+}
+
+int LNM_RulesProfileMatch(uint32_t require, uint32_t exclude)
+{
+    return (profile & require) == require && (profile & exclude) == 0;
+}
+
+static int Rules_Guard(const LNM_Rule *r)
+{
+    if (r->guard_val == NULL)
+    {
+        return 1;
+    }
+    return (strcmp(LNM_SysCfgCacheGetStr((eLnmCfgKey)r->guard_cfg), r->guard_val) == 0) != (r->guard_not != 0);
+}
+
+unsigned int LNM_RulesFire(eLnmRuleTrigger trigger)
+{
+    char val[64];
+    unsigned int i, fired = 0;
+
+    if (trigger < 0 || trigger >= LNM_RULE_TRIGGER_MAX)
+    {
+        return 0;
+    }
+    for (i = first[trigger]; i < first[trigger + 1]; i++)
+    {
+        const LNM_Rule *r = active[i];
+        const char *v = r->set_val != NULL ? r->set_val : "";
+
+        if ((r->once != 0 && LNM_StateFlag(r->once)) || !Rules_Guard(r))
+        {
+            continue;
+        }
+        if (r->set_val_from != NULL)
+        {
+            if (LNM_SyseventGet(r->set_val_from, val, sizeof(val)) != 0 || val[0] == '\0')
+            {
+                continue;
+            }
+            v = val;
+        }
+        LanManagerInfo((" Setting %s event \n", r->set_name));
+        LNM_SyseventSetAsync(r->set_name, v, r->lane, NULL, NULL);
+        if (r->once != 0)
+        {
+            LNM_StateSetFlag(r->once);
+        }
+        fired++;
+    }
+    return fired;
+}
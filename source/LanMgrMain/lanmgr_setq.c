@@ -0,0 +1,391 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sysevent/sysevent.h>
+#include "lanmgr_evloop.h"
+#include "lanmgr_executor.h"
+#include "lanmgr_footprint.h"
+#include "lanmgr_journal.h"
+#include "lanmgr_log.h"
+#include "lanmgr_setq.h"
+#include "lanmgr_sysevent.h"
+#include "lanmgr_watchdog.h"
+
+typedef enum
+{
+    SETQ_FREE = 0,
+    SETQ_PENDING,
+    SETQ_INFLIGHT,
+    SETQ_DONE
+} eSetqState;
+
+typedef struct
+{
+    eSetqState     state;
+    unsigned int   seq;
+    unsigned int   lane;
+    int            rc;
+    LNM_SetDoneCb  done;
+    void          *arg;
+    char           name[64];
+    char           val[64];
+} LNM_SetCmd;
+
+static LNM_SetCmd setq[LNM_SETQ_DEPTH];
+static pthread_mutex_t setq_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t setq_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t space_cond = PTHREAD_COND_INITIALIZER;  /* a command finished */
+typedef struct
+{
+    pthread_t  tid;
+    int        fd;          /* writer session, only touched by its thread */
+    token_t    token;
+} LNM_SetWriter;
+
+static LNM_SetWriter writers[LNM_SETQ_MAX_WORKERS];
+static int num_writers = 0;
+static int writer_running = 0;
+static int writer_stopping = 0;
+static int done_fd = -1;
+static unsigned int next_seq = 1;
+
+static int SetQueue_WriterSet(LNM_SetWriter *w, const LNM_SetCmd *c)
+{
+    int attempt, rc = -1;
+
+    for (attempt = 0; attempt < 2 && rc != 0; attempt++)
+    {
+        if (w->fd < 0)
+        {
+            w->fd = sysevent_open("127.0.0.1", SE_SERVER_WELL_KNOWN_PORT, SE_VERSION, "lan_manager_tx", &w->token);
+        }
+        if (w->fd < 0)
+        {
+            continue;
+        }
+        LNM_WatchdogBegin(c->name, LNM_SETQ_SET_DEADLINE_MSECS);
+        rc = sysevent_set(w->fd, w->token, c->name, c->val, 0);
+        LNM_WatchdogEnd();
+        if (rc != 0)
+        {
+            /* reopen once, the server may have restarted under us */
+            sysevent_close(w->fd, w->token);
+            w->fd = -1;
+        }
+    }
+    return rc;
+}
+
+/* Oldest pending command whose lane has nothing in flight. Called locked. */
+static LNM_SetCmd *SetQueue_Pick(void)
+{
+    LNM_SetCmd *best = NULL;
+    int i, j;
+
+    for (i = 0; i < LNM_SETQ_DEPTH; i++)
+    {
+        /* keep the oldest candidate, sequence compare is wrap safe */
+        if (setq[i].state != SETQ_PENDING ||
+            (best != NULL && (int)(setq[i].seq - best->seq) > 0))
+        {
+            continue;
+        }
+        for (j = 0; j < LNM_SETQ_DEPTH; j++)
+        {
+            if (setq[j].state == SETQ_INFLIGHT && setq[j].lane == setq[i].lane)
+            {
+                break;
+            }
+        }
+        if (j == LNM_SETQ_DEPTH)
+        {
+            best = &setq[i];
+        }
+    }
+    return best;
+}
+
+static int SetQueue_HasPending(void)
+{
+    int i;
+
+    for (i = 0; i < LNM_SETQ_DEPTH; i++)
+    {
+        if (setq[i].state == SETQ_PENDING)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void *SetQueue_Writer(void *arg)
+{
+    LNM_SetWriter *w = arg;
+    LNM_SetCmd *c;
+    uint64_t one = 1;
+    int rc, wake_errno;
+
+    LNM_WatchdogRegister("setq writer");
+    pthread_mutex_lock(&setq_lock);
+    for (;;)
+    {
+        c = SetQueue_Pick();
+        if (c == NULL)
+        {
+            if (writer_stopping && !SetQueue_HasPending())
+            {
+                break;
+            }
+            pthread_cond_wait(&setq_cond, &setq_lock);
+            continue;
+        }
+        c->state = SETQ_INFLIGHT;
+        pthread_mutex_unlock(&setq_lock);
+
+        rc = SetQueue_WriterSet(w, c);
+        LNM_JournalAppend(LNM_JOURNAL_SET_DONE, c->name, c->val, rc);
+
+        pthread_mutex_lock(&setq_lock);
+        c->rc = rc;
+        c->state = SETQ_DONE;
+        /* the lane is free again, another writer may be waiting for it */
+        pthread_cond_broadcast(&setq_cond);
+        pthread_cond_broadcast(&space_cond);
+        wake_errno = write(done_fd, &one, sizeof(one)) < 0 ? errno : 0;
+        if (wake_errno != 0)
+        {
+            /* no log I/O under the lock, the other writers wait on it */
+            pthread_mutex_unlock(&setq_lock);
+            LanManagerError(("%s: eventfd write failed, errno=%d\n", __FUNCTION__, wake_errno));
+            pthread_mutex_lock(&setq_lock);
+        }
+    }
+    pthread_mutex_unlock(&setq_lock);
+    if (w->fd >= 0)
+    {
+        sysevent_close(w->fd, w->token);
+        w->fd = -1;
+    }
+    return NULL;
+}
+
+static void SetQueue_Complete(LNM_SetCmd *c)
+{
+    if (c->rc != 0)
+    {
+        LanManagerErrorRL((" sysevent_set %s failed, rc=%d \n", c->name, c->rc));
+    }
+    if (c->done != NULL)
+    {
+        c->done(c->seq, c->rc, c->arg);
+    }
+}
+
+/* Report finished commands in queue order on the executor. */
+static void SetQueue_Drain(void *arg)
+{
+    LNM_SetCmd done[LNM_SETQ_DEPTH];
+    int n = 0, i, j;
+
+    pthread_mutex_lock(&setq_lock);
+    for (i = 0; i < LNM_SETQ_DEPTH; i++)
+    {
+        if (setq[i].state == SETQ_DONE)
+        {
+            LNM_SetCmd c = setq[i];
+            /* insertion sort by sequence, wrap safe */
+            for (j = n; j > 0 && (int)(done[j - 1].seq - c.seq) > 0; j--)
+            {
+                done[j] = done[j - 1];
+            }
+            done[j] = c;
+            n++;
+            setq[i].state = SETQ_FREE;
+        }
+    }
+    if (n != 0)
+    {
+        pthread_cond_broadcast(&space_cond);
+    }
+    pthread_mutex_unlock(&setq_lock);
+    for (i = 0; i < n; i++)
+    {
+        SetQueue_Complete(&done[i]);
+    }
+}
+
+/* Free slot, NULL if the queue is full. Called locked. */
+static LNM_SetCmd *SetQueue_Slot(int *has_done)
+{
+    int i;
+
+    *has_done = 0;
+    for (i = 0; i < LNM_SETQ_DEPTH; i++)
+    {
+        if (setq[i].state == SETQ_FREE)
+        {
+            return &setq[i];
+        }
+        *has_done |= setq[i].state == SETQ_DONE;
+    }
+    return NULL;
+}
+
+static void SetQueue_Wakeup(int fd, uint32_t events, void *arg)
+{
+    uint64_t count;
+
+    if (read(fd, &count, sizeof(count)) < 0 && errno != EAGAIN)
+    {
+        LanManagerError(("%s: eventfd read failed, errno=%d\n", __FUNCTION__, errno));
+    }
+    LNM_ExecutorPost(SetQueue_Drain, NULL);
+}
+
+int LNM_SetQueueInit(int workers)
+{
+    int i;
+
+    if (workers < 1 || workers > LNM_SETQ_MAX_WORKERS)
+    {
+        workers = LNM_SETQ_DEFAULT_WORKERS;
+    }
+    done_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (done_fd < 0)
+    {
+        LanManagerError(("%s: eventfd failed, errno=%d\n", __FUNCTION__, errno));
+        return -1;
+    }
+    if (LNM_EvLoopAddFd(done_fd, EPOLLIN, SetQueue_Wakeup, NULL) != 0)
+    {
+        close(done_fd);
+        done_fd = -1;
+        return -1;
+    }
+    for (i = 0; i < workers; i++)
+    {
+        writers[i].fd = -1;
+        if (LNM_ThreadCreate(&writers[i].tid, SetQueue_Writer, &writers[i]) != 0)
+        {
+            LanManagerError(("%s: writer thread create failed\n", __FUNCTION__));
+            break;
+        }
+        num_writers++;
+    }
+    if (num_writers == 0)
+    {
+        LNM_EvLoopDelFd(done_fd);
+        close(done_fd);
+        done_fd = -1;
+        return -1;
+    }
+    writer_running = 1;
+    return 0;
+}
+
+void LNM_SetQueueStop(void)
+{
+    int i;
+
+    if (!writer_running)
+    {
+        return;
+    }
+    pthread_mutex_lock(&setq_lock);
+    writer_stopping = 1;
+    pthread_cond_broadcast(&setq_cond);
+    pthread_mutex_unlock(&setq_lock);
+    for (i = 0; i < num_writers; i++)
+    {
+        pthread_join(writers[i].tid, NULL);
+    }
+    num_writers = 0;
+    writer_running = 0;
+    /* the executor is stopped by now, report the rest here */
+    SetQueue_Drain(NULL);
+    LNM_EvLoopDelFd(done_fd);
+    close(done_fd);
+    done_fd = -1;
+}
+
+unsigned int LNM_SyseventSetAsync(const char *name, const char *val, unsigned int lane,
+                                  LNM_SetDoneCb done, void *arg)
+{
+    LNM_SetCmd *c = NULL;
+    unsigned int seq;
+    int has_done, waited = 0;
+
+    pthread_mutex_lock(&setq_lock);
+    while (writer_running && (c = SetQueue_Slot(&has_done)) == NULL)
+    {
+        /* full: wait rather than overtake the queued commands of the lane.
+         * Slots are freed by the drain, which may be the caller itself */
+        waited = 1;
+        if (has_done && LNM_ExecutorOnThread())
+        {
+            pthread_mutex_unlock(&setq_lock);
+            SetQueue_Drain(NULL);
+            pthread_mutex_lock(&setq_lock);
+            continue;
+        }
+        pthread_cond_wait(&space_cond, &setq_lock);
+    }
+    seq = next_seq++;
+    if (next_seq == 0)
+    {
+        next_seq = 1;
+    }
+    if (c != NULL)
+    {
+        c->seq = seq;
+        c->lane = lane;
+        c->rc = -1;
+        c->done = done;
+        c->arg = arg;
+        snprintf(c->name, sizeof(c->name), "%s", name);
+        snprintf(c->val, sizeof(c->val), "%s", val);
+        c->state = SETQ_PENDING;
+        /* journaled before a writer can complete it */
+        LNM_JournalAppend(LNM_JOURNAL_SET, name, val, (int32_t)lane);
+        pthread_cond_signal(&setq_cond);
+    }
+    pthread_mutex_unlock(&setq_lock);
+
+    if (waited)
+    {
+        LanManagerWarnRL((" set queue full, %s waited for a slot \n", name));
+    }
+    if (c == NULL)
+    {
+        /* no writer, so nothing queued either: issue it inline */
+        int rc = LNM_SyseventSet(name, val);
+        if (done != NULL)
+        {
+            done(seq, rc, arg);
+        }
+    }
+    return seq;
+}
@@ -0,0 +1,122 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "lanmgr_log.h"
+#include "lanmgr_state.h"
+
+static LNM_PersistState fallback_state;
+static LNM_PersistState *state = &fallback_state;
+
+static void State_Reset(LNM_PersistState *s)
+{
+    memset(s, 0, sizeof(*s));
+    s->magic = LNM_STATE_MAGIC;
+    s->version = LNM_STATE_VERSION;
+    s->size = sizeof(*s);
+}
+
+static int State_Valid(const LNM_PersistState *s)
+{
+    return s->magic == LNM_STATE_MAGIC && s->version == LNM_STATE_VERSION &&
+           s->size == sizeof(*s) && (s->seq & 1) == 0;
+}
+
+int LNM_StateInit(const char *path)
+{
+    struct stat st;
+    void *p;
+    int fd, restored;
+
+    fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (fd < 0)
+    {
+        LanManagerError((" cannot open %s, errno=%d, state is not persisted \n", path, errno));
+        State_Reset(state);
+        return 0;
+    }
+    restored = fstat(fd, &st) == 0 && st.st_size == (off_t)sizeof(LNM_PersistState);
+    if (!restored && ftruncate(fd, sizeof(LNM_PersistState)) != 0)
+    {
+        LanManagerError((" cannot size %s, errno=%d, state is not persisted \n", path, errno));
+        close(fd);
+        State_Reset(state);
+        return 0;
+    }
+    p = mmap(NULL, sizeof(LNM_PersistState), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    /* the mapping keeps the file referenced */
+    close(fd);
+    if (p == MAP_FAILED)
+    {
+        LanManagerError((" cannot map %s, errno=%d, state is not persisted \n", path, errno));
+        State_Reset(state);
+        return 0;
+    }
+    state = p;
+    if (restored && !State_Valid(state))
+    {
+        LanManagerWarn((" discarding %s: magic 0x%x version %u size %u seq %u \n", path,
+                        state->magic, state->version, state->size, state->seq));
+        restored = 0;
+    }
+    if (!restored)
+    {
+        State_Reset(state);
+    }
+    return restored;
+}
+
+const LNM_PersistState *LNM_StateGet(void)
+{
+    return state;
+}
+
+LNM_PersistState *LNM_StateBegin(void)
+{
+    state->seq++;
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    return state;
+}
+
+void LNM_StateCommit(void)
+{
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    state->seq++;
+}
+
+int LNM_StateFlag(uint32_t flag)
+{
+    return (state->flags & flag) != 0;
+}
+
+void LNM_StateSetFlag(uint32_t flag)
+{
+    LNM_StateBegin()->flags |= flag;
+    LNM_StateCommit();
+}
+
+void LNM_StateClearFlag(uint32_t flag)
+{
+    LNM_StateBegin()->flags &= ~flag;
+    LNM_StateCommit();
+}
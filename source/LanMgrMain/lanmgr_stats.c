@@ -0,0 +1,124 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "lanmgr_log.h"
+#include "lanmgr_stats.h"
+
+static LNM_StatsPage fallback_page;
+static LNM_StatsPage *page = &fallback_page;
+static pthread_mutex_t snap_lock = PTHREAD_MUTEX_INITIALIZER;
+
+int LNM_StatsInit(const char *path)
+{
+    LNM_StatsPage init;
+    void *p;
+    int fd;
+
+    /* counters taken before init are kept */
+    memcpy(&init, page, sizeof(init));
+    init.magic = LNM_STATS_MAGIC;
+    init.version = LNM_STATS_VERSION;
+    init.size = sizeof(init);
+    init.pid = (uint32_t)getpid();
+    init.seq = 0;
+    init.started = (int64_t)time(NULL);
+
+    /* a fresh inode, readers still mapping a previous instance keep theirs */
+    unlink(path);
+    fd = open(path, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        LanManagerError((" cannot create %s, errno=%d, stats are not published \n", path, errno));
+        memcpy(page, &init, sizeof(init));
+        return -1;
+    }
+    /* umask must not hide the page from unprivileged readers */
+    fchmod(fd, 0644);
+    if (write(fd, &init, sizeof(init)) != (ssize_t)sizeof(init))
+    {
+        LanManagerError((" cannot write %s, errno=%d, stats are not published \n", path, errno));
+        close(fd);
+        unlink(path);
+        memcpy(page, &init, sizeof(init));
+        return -1;
+    }
+    p = mmap(NULL, sizeof(LNM_StatsPage), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED)
+    {
+        LanManagerError((" cannot map %s, errno=%d, stats are not published \n", path, errno));
+        unlink(path);
+        memcpy(page, &init, sizeof(init));
+        return -1;
+    }
+    page = p;
+    return 0;
+}
+
+void LNM_StatsInc(eLnmStat stat)
+{
+    if (stat >= 0 && stat < LNM_STAT_MAX)
+    {
+        __atomic_fetch_add(&page->counters[stat], 1, __ATOMIC_RELAXED);
+    }
+}
+
+void LNM_StatsEvent(int type)
+{
+    if (type >= 0 && type < LNM_STATS_EVENT_TYPES)
+    {
+        __atomic_fetch_add(&page->events[type], 1, __ATOMIC_RELAXED);
+    }
+}
+
+void LNM_StatsEventName(int type, const char *name)
+{
+    if (type >= 0 && type < LNM_STATS_EVENT_TYPES)
+    {
+        snprintf(page->event_names[type], sizeof(page->event_names[type]), "%s", name);
+    }
+}
+
+LNM_ExecutorStats *LNM_StatsExecutor(void)
+{
+    return &page->exec;
+}
+
+LNM_StatsSnapshot *LNM_StatsBegin(void)
+{
+    pthread_mutex_lock(&snap_lock);
+    __atomic_store_n(&page->seq, page->seq + 1, __ATOMIC_RELAXED);
+    /* the odd sequence is visible before any snapshot store */
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    return &page->snap;
+}
+
+void LNM_StatsCommit(void)
+{
+    __atomic_store_n(&page->seq, page->seq + 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&snap_lock);
+}
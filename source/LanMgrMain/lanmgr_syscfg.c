@@ -0,0 +1,219 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <syscfg/syscfg.h>
+#include "lanmgr_journal.h"
+#include "lanmgr_log.h"
+#include "lanmgr_syscfg.h"
+#include "lanmgr_sysevent.h"
+
+typedef struct
+{
+    const char  *name;
+    const char  *event;     /* sysevent announcing a change, NULL if none */
+    int          optional;  /* tuning key, absence is not an error */
+    int          valid;
+    int          status;    /* syscfg_get() result of the last load */
+    int          ival;
+    char         sval[20];
+} LNM_CfgEntry;
+
+static LNM_CfgEntry cfg_cache[LNM_CFG_MAX] = {
+    [LNM_CFG_BRIDGE_MODE]           = { "bridge_mode",               "bridge_mode",          0 },
+    [LNM_CFG_LAST_EROUTER_MODE]     = { "last_erouter_mode",         "erouter_mode-updated", 0 },
+    [LNM_CFG_4_TO_6_ENABLED]        = { "4_to_6_enabled",            NULL,                   0 },
+    [LNM_CFG_LOST_AND_FOUND_ENABLE] = { "lost_and_found_enable",     NULL,                   0 },
+    [LNM_CFG_LAN_START_COALESCE_MS] = { "lan_start_coalesce_ms",     NULL,                   1 },
+    [LNM_CFG_LAN_MANAGER_PROFILE]   = { "lan_manager_profile",       NULL,                   1 },
+    [LNM_CFG_LOW_FOOTPRINT]         = { "lan_manager_low_footprint", NULL,                   1 },
+    [LNM_CFG_FACTORY_MODE]          = { "lan_manager_factory_mode",  NULL,                   1 },
+};
+
+static const char *db_path = NULL;
+static struct timespec db_mtime;
+static off_t db_size = -1;
+static unsigned int cfg_session = 0;
+
+static void SysCfg_Load(LNM_CfgEntry *e)
+{
+    e->status = syscfg_get(NULL, e->name, e->sval, sizeof(e->sval));
+    if (e->status != 0)
+    {
+        if (!e->optional)
+        {
+            LanManagerError((" syscfg get %s failed \n", e->name));
+        }
+        e->sval[0] = '\0';
+        e->ival = -1;
+    }
+    else
+    {
+        e->ival = atoi(e->sval);
+    }
+    e->valid = 1;
+    LNM_JournalAppend(LNM_JOURNAL_CFG, e->name, e->sval, e->status);
+    LanManagerDebug((" syscfg cache %s = %s \n", e->name, e->sval));
+}
+
+/* The database file, NULL while none is found. */
+static const char *SysCfg_DbPath(void)
+{
+#ifdef LNM_SYSCFG_DB_FILE
+    db_path = LNM_SYSCFG_DB_FILE;
+#else
+    static const char *const paths[] = { LNM_SYSCFG_DB_PATHS };
+    struct stat st;
+    unsigned int i;
+
+    for (i = 0; db_path == NULL && i < sizeof(paths) / sizeof(paths[0]); i++)
+    {
+        if (stat(paths[i], &st) == 0)
+        {
+            db_path = paths[i];
+            LanManagerInfo((" syscfg database %s \n", db_path));
+        }
+    }
+#endif
+    return db_path;
+}
+
+/* Generation check: one stat() of the committed database instead of a
+ * syscfg lookup per key. Any change drops the whole cache. */
+static void SysCfg_CheckGeneration(void)
+{
+    const char *path = SysCfg_DbPath();
+    struct stat st;
+    int i;
+
+    if (path != NULL && stat(path, &st) == 0 &&
+        (st.st_size != db_size ||
+         st.st_mtim.tv_sec != db_mtime.tv_sec || st.st_mtim.tv_nsec != db_mtime.tv_nsec))
+    {
+        db_size = st.st_size;
+        db_mtime = st.st_mtim;
+        for (i = 0; i < LNM_CFG_MAX; i++)
+        {
+            cfg_cache[i].valid = 0;
+        }
+    }
+    if (cfg_session != LNM_SyseventSession())
+    {
+        cfg_session = LNM_SyseventSession();
+        for (i = 0; i < LNM_CFG_MAX; i++)
+        {
+            if (cfg_cache[i].event != NULL)
+            {
+                cfg_cache[i].valid = 0;
+            }
+        }
+    }
+}
+
+static LNM_CfgEntry *SysCfg_Get(eLnmCfgKey key)
+{
+    LNM_CfgEntry *e;
+
+    if (key < 0 || key >= LNM_CFG_MAX)
+    {
+        return NULL;
+    }
+    SysCfg_CheckGeneration();
+    e = &cfg_cache[key];
+    if (!e->valid)
+    {
+        SysCfg_Load(e);
+    }
+    return e;
+}
+
+void LNM_SysCfgCacheInit(void)
+{
+    int i;
+
+    SysCfg_CheckGeneration();
+    for (i = 0; i < LNM_CFG_MAX; i++)
+    {
+        SysCfg_Load(&cfg_cache[i]);
+    }
+}
+
+int LNM_SysCfgPeekInt(eLnmCfgKey key)
+{
+    char val[20];
+
+    if (key < 0 || key >= LNM_CFG_MAX ||
+        syscfg_get(NULL, cfg_cache[key].name, val, sizeof(val)) != 0)
+    {
+        return -1;
+    }
+    return atoi(val);
+}
+
+int LNM_SysCfgCacheGetInt(eLnmCfgKey key)
+{
+    LNM_CfgEntry *e = SysCfg_Get(key);
+
+    return e != NULL ? e->ival : -1;
+}
+
+const char *LNM_SysCfgCacheGetStr(eLnmCfgKey key)
+{
+    LNM_CfgEntry *e = SysCfg_Get(key);
+
+    return e != NULL ? e->sval : "";
+}
+
+int LNM_SysCfgCacheNotify(const char *name)
+{
+    int i, found = 0;
+
+    for (i = 0; i < LNM_CFG_MAX; i++)
+    {
+        if (cfg_cache[i].event != NULL && strcmp(cfg_cache[i].event, name) == 0)
+        {
+            cfg_cache[i].valid = 0;
+            found = 1;
+        }
+    }
+    return found;
+}
+
+void LNM_SysCfgCacheRefresh(void)
+{
+    int i;
+
+    for (i = 0; i < LNM_CFG_MAX; i++)
+    {
+        if (cfg_cache[i].event == NULL)
+        {
+            cfg_cache[i].valid = 0;
+        }
+    }
+}
+
+void LNM_SysCfgCacheInvalidate(eLnmCfgKey key)
+{
+    if (key >= 0 && key < LNM_CFG_MAX)
+    {
+        cfg_cache[key].valid = 0;
+    }
+}
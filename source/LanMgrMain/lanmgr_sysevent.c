@@ -0,0 +1,362 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+#include <sysevent/sysevent.h>
+#include "lanmgr_daemon.h"
+#include "lanmgr_evloop.h"
+#include "lanmgr_journal.h"
+#include "lanmgr_log.h"
+#include "lanmgr_setq.h"
+#include "lanmgr_stats.h"
+#include "lanmgr_sysevent.h"
+
+typedef struct
+{
+    char        name[64];
+    async_id_t  asyncid;
+} LNM_SeNotification;
+
+static int sysevent_fd = -1;
+static token_t sysevent_token;
+static int connected = 0;
+static unsigned int session = 0;
+static int reconnect_timer = -1;
+static int fallback_fd = -1;        /* reconnect timer if the loop has none left */
+static int fallback_armed = 0;
+static unsigned int backoff_ms = 0;
+static unsigned int jitter_seed = 0;
+static LNM_SyseventNotifyCb notify_cb = NULL;
+static LNM_SeNotification notifications[LNM_SE_MAX_NOTIFICATIONS];
+static int num_notifications = 0;
+static pthread_mutex_t request_lock = PTHREAD_MUTEX_INITIALIZER;
+static int request_fd = -1;         /* gets and sets, under request_lock */
+static token_t request_token;
+
+static void Sysevent_Process(int fd, uint32_t events, void *arg);
+static void Sysevent_Connect(void *arg);
+
+/* Next reconnect delay: the backoff doubles from LNM_SE_BACKOFF_MIN_MSECS up
+ * to LNM_SE_BACKOFF_MAX_MSECS, and the delay is drawn from the upper half
+ * of it so a fleet of restarting clients does not reconnect in lock step. */
+static unsigned int Sysevent_NextDelay(void)
+{
+    if (backoff_ms == 0)
+    {
+        backoff_ms = LNM_SE_BACKOFF_MIN_MSECS;
+    }
+    else if (backoff_ms < LNM_SE_BACKOFF_MAX_MSECS)
+    {
+        backoff_ms *= 2;
+        if (backoff_ms > LNM_SE_BACKOFF_MAX_MSECS)
+        {
+            backoff_ms = LNM_SE_BACKOFF_MAX_MSECS;
+        }
+    }
+    return backoff_ms / 2 + rand_r(&jitter_seed) % (backoff_ms / 2 + 1);
+}
+
+static void Sysevent_FallbackExpired(int fd, uint32_t events, void *arg)
+{
+    uint64_t expirations;
+
+    if (read(fd, &expirations, sizeof(expirations)) < 0)
+    {
+        return;
+    }
+    fallback_armed = 0;
+    Sysevent_Connect(NULL);
+}
+
+static void Sysevent_ScheduleReconnect(void)
+{
+    struct itimerspec its;
+    unsigned int delay;
+
+    if (reconnect_timer > 0 || fallback_armed)
+    {
+        return;
+    }
+    delay = Sysevent_NextDelay();
+    LanManagerInfo((" sysevent reconnect in %u ms \n", delay));
+    reconnect_timer = LNM_EvLoopAddTimer(delay, Sysevent_Connect, NULL);
+    if (reconnect_timer > 0)
+    {
+        return;
+    }
+    /* without a reconnect lan_manager would stay deaf for good */
+    memset(&its, 0, sizeof(its));
+    its.it_value.tv_sec = delay / 1000;
+    its.it_value.tv_nsec = (long)(delay % 1000 ? delay % 1000 : 1) * 1000000;
+    if (fallback_fd >= 0 && timerfd_settime(fallback_fd, 0, &its, NULL) == 0)
+    {
+        LanManagerError((" no loop timer for the sysevent reconnect, using the fallback timer \n"));
+        fallback_armed = 1;
+        return;
+    }
+    LanManagerError((" cannot schedule the sysevent reconnect, errno=%d \n", errno));
+}
+
+static void Sysevent_Disconnect(void)
+{
+    if (sysevent_fd >= 0)
+    {
+        LNM_EvLoopDelFd(sysevent_fd);
+        sysevent_close(sysevent_fd, sysevent_token);
+    }
+    sysevent_fd = -1;
+    connected = 0;
+}
+
+static int Sysevent_Register(LNM_SeNotification *n)
+{
+    int rc = sysevent_setnotification(sysevent_fd, sysevent_token, n->name, &n->asyncid);
+    if (rc != 0)
+    {
+        LanManagerError((" sysevent_setnotification %s failed, rc=%d \n", n->name, rc));
+    }
+    return rc;
+}
+
+/* Notifications sent while the session was down are lost: deliver the
+ * current value of every subscribed event instead, as if it had just been
+ * notified. Handlers take a value they already have as a repeat. */
+static void Sysevent_Resync(void)
+{
+    char val[64];
+    int i, n = 0;
+
+    for (i = 0; i < num_notifications; i++)
+    {
+        if (LNM_SyseventGet(notifications[i].name, val, sizeof(val)) != 0 || val[0] == '\0')
+        {
+            continue;
+        }
+        LNM_JournalAppend(LNM_JOURNAL_IN, notifications[i].name, val, 0);
+        if (notify_cb != NULL)
+        {
+            notify_cb(notifications[i].name, val);
+        }
+        n++;
+    }
+    LanManagerInfo((" sysevent session %u: %d event value(s) re-read \n", session, n));
+}
+
+static void Sysevent_Connect(void *arg)
+{
+    int i;
+
+    reconnect_timer = -1;
+    Sysevent_Disconnect();
+    sysevent_fd = sysevent_open("127.0.0.1", SE_SERVER_WELL_KNOWN_PORT, SE_VERSION, "lan_manager", &sysevent_token);
+    LanManagerInfo((" sysevent_fd %d \n", sysevent_fd));
+    if (sysevent_fd < 0)
+    {
+        Sysevent_ScheduleReconnect();
+        return;
+    }
+    for (i = 0; i < num_notifications; i++)
+    {
+        if (Sysevent_Register(&notifications[i]) != 0)
+        {
+            Sysevent_Disconnect();
+            Sysevent_ScheduleReconnect();
+            return;
+        }
+    }
+    if (LNM_EvLoopAddFd(sysevent_fd, EPOLLIN | EPOLLRDHUP, Sysevent_Process, NULL) != 0)
+    {
+        Sysevent_Disconnect();
+        Sysevent_ScheduleReconnect();
+        return;
+    }
+    connected = 1;
+    LanManagerInfo((" Set notifications done \n"));
+    if (session++ != 0)
+    {
+        LNM_StatsInc(LNM_STAT_SE_RECONNECTS);
+        Sysevent_Resync();
+    }
+    /* dependent units may start once every notification is registered */
+    LNM_DaemonReady();
+}
+
+static void Sysevent_Process(int fd, uint32_t events, void *arg)
+{
+    char name[64], val[64];
+    int namelen = sizeof(name);
+    int vallen  = sizeof(val);
+    int err;
+    async_id_t getnotification_asyncid;
+
+    if (events & (EPOLLHUP | EPOLLERR | EPOLLRDHUP))
+    {
+        LanManagerError((" sysevent session closed by peer, events=0x%x \n", events));
+        Sysevent_Disconnect();
+        Sysevent_ScheduleReconnect();
+        return;
+    }
+    LanManagerInfo(("get notification\n"));
+    err = sysevent_getnotification(fd, sysevent_token, name, &namelen,  val, &vallen, &getnotification_asyncid);
+    if (err)
+    {
+        LNM_StatsInc(LNM_STAT_SE_ERRORS);
+        LanManagerErrorRL((" sysevent_getnotification failed, err=%d \n", err));
+        /* the session cannot be trusted any more, start a fresh one */
+        Sysevent_Disconnect();
+        Sysevent_ScheduleReconnect();
+        return;
+    }
+    /* a healthy session resets the backoff for the next failure */
+    backoff_ms = 0;
+    LNM_JournalAppend(LNM_JOURNAL_IN, name, val, 0);
+    LNM_StatsInc(LNM_STAT_SE_NOTIFICATIONS);
+    if (notify_cb != NULL)
+    {
+        notify_cb(name, val);
+    }
+}
+
+int LNM_SyseventInit(LNM_SyseventNotifyCb cb)
+{
+    if (cb == NULL)
+    {
+        return -1;
+    }
+    notify_cb = cb;
+    jitter_seed = (unsigned int)getpid() ^ (unsigned int)LNM_MonotonicMs();
+    /* a write to a dead session must fail with EPIPE, not kill the process */
+    signal(SIGPIPE, SIG_IGN);
+    fallback_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fallback_fd >= 0 && LNM_EvLoopAddFd(fallback_fd, EPOLLIN, Sysevent_FallbackExpired, NULL) != 0)
+    {
+        close(fallback_fd);
+        fallback_fd = -1;
+    }
+    Sysevent_Connect(NULL);
+    return 0;
+}
+
+int LNM_SyseventSubscribe(const char *name)
+{
+    LNM_SeNotification *n;
+
+    if (name == NULL || num_notifications >= LNM_SE_MAX_NOTIFICATIONS)
+    {
+        LanManagerError((" cannot subscribe to %s \n", name ? name : "(null)"));
+        return -1;
+    }
+    n = &notifications[num_notifications++];
+    snprintf(n->name, sizeof(n->name), "%s", name);
+    if (connected && Sysevent_Register(n) != 0)
+    {
+        Sysevent_Disconnect();
+        Sysevent_ScheduleReconnect();
+    }
+    return 0;
+}
+
+int LNM_SyseventConnected(void)
+{
+    return connected;
+}
+
+unsigned int LNM_SyseventSession(void)
+{
+    return session;
+}
+
+/* Gets and sets have a session of their own so they can be issued off the
+ * loop thread without interleaving with the notification stream. A failed
+ * request is retried once on a fresh session. Called with request_lock held. */
+static int Sysevent_Request(const char *name, char *buf, int buflen, const char *val)
+{
+    int attempt, rc = -1;
+
+    for (attempt = 0; attempt < 2 && rc != 0; attempt++)
+    {
+        if (request_fd < 0)
+        {
+            request_fd = sysevent_open("127.0.0.1", SE_SERVER_WELL_KNOWN_PORT, SE_VERSION, "lan_manager_rq", &request_token);
+        }
+        if (request_fd < 0)
+        {
+            continue;
+        }
+        if (val != NULL)
+        {
+            rc = sysevent_set(request_fd, request_token, name, val, 0);
+        }
+        else
+        {
+            rc = sysevent_get(request_fd, request_token, name, buf, buflen);
+        }
+        if (rc != 0)
+        {
+            sysevent_close(request_fd, request_token);
+            request_fd = -1;
+        }
+    }
+    return rc;
+}
+
+int LNM_SyseventGet(const char *name, char *buf, int buflen)
+{
+    int rc;
+
+    if (buflen > 0)
+    {
+        buf[0] = '\0';
+    }
+    pthread_mutex_lock(&request_lock);
+    rc = Sysevent_Request(name, buf, buflen, NULL);
+    pthread_mutex_unlock(&request_lock);
+    LNM_JournalAppend(LNM_JOURNAL_GET, name, rc == 0 ? buf : NULL, rc);
+    if (rc != 0)
+    {
+        LanManagerErrorRL((" sysevent_get %s failed, rc=%d \n", name, rc));
+        if (buflen > 0)
+        {
+            buf[0] = '\0';
+        }
+    }
+    return rc;
+}
+
+int LNM_SyseventSet(const char *name, const char *val)
+{
+    int rc;
+
+    LNM_JournalAppend(LNM_JOURNAL_SET, name, val, LNM_SETQ_LANE_ORDERED);
+    pthread_mutex_lock(&request_lock);
+    rc = Sysevent_Request(name, NULL, 0, val);
+    pthread_mutex_unlock(&request_lock);
+    LNM_JournalAppend(LNM_JOURNAL_SET_DONE, name, val, rc);
+    if (rc != 0)
+    {
+        LanManagerErrorRL((" sysevent_set %s failed, rc=%d \n", name, rc));
+    }
+    return rc;
+}
@@ -0,0 +1,129 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <string.h>
+#include <telemetry_busmessage_sender.h>
+#include "lanmgr_evloop.h"
+#include "lanmgr_log.h"
+#include "lanmgr_telemetry.h"
+
+typedef struct
+{
+    char       *marker;
+    eLnmStage   from;
+    eLnmStage   to;
+    int         once;       /* boot only latency, recorded a single time */
+    int         armed;      /* from was marked since the last record */
+} LNM_LatencyDef;
+
+static LNM_LatencyDef latencies[LNM_LAT_MAX] = {
+    [LNM_LAT_INIT_TO_PNM]          = { "lnm_init_to_pnm_split",          LNM_STAGE_INIT,          LNM_STAGE_PNM,           1 },
+    [LNM_LAT_INIT_TO_L3NET]        = { "lnm_init_to_l3net_split",        LNM_STAGE_INIT,          LNM_STAGE_L3NET,         1 },
+    [LNM_LAT_TRIGGER_TO_LAN_START] = { "lnm_trigger_to_lanstart_split",  LNM_STAGE_TRIGGERED,     LNM_STAGE_LAN_START,     0 },
+    [LNM_LAT_LAN_START_TO_SET]     = { "lnm_lanstart_to_set_split",      LNM_STAGE_LAN_START,     LNM_STAGE_LAN_START_SET, 0 },
+    [LNM_LAT_SET_TO_LAN_STARTED]   = { "lnm_set_to_lanstatus_split",     LNM_STAGE_LAN_START_SET, LNM_STAGE_LAN_STARTED,   0 },
+    [LNM_LAT_INIT_TO_LAN_STARTED]  = { "lnm_init_to_lanstatus_split",    LNM_STAGE_INIT,          LNM_STAGE_LAN_STARTED,   1 },
+    [LNM_LAT_MODE_SWITCH]          = { "lnm_mode_switch_split",          LNM_STAGE_MODE_CHANGE,   LNM_STAGE_MODE_SWITCHED, 0 },
+};
+
+static uint64_t stage_ms[LNM_STAGE_MAX];
+static LNM_Histogram histograms[LNM_LAT_MAX];
+
+static void Telemetry_Record(eLnmLatency lat, uint32_t ms)
+{
+    LNM_Histogram *h = &histograms[lat];
+    int bucket = 0;
+    uint32_t v = ms;
+
+    while (v != 0 && bucket < LNM_HIST_BUCKETS - 1)
+    {
+        v >>= 1;
+        bucket++;
+    }
+    h->buckets[bucket]++;
+    if (h->count == 0 || ms < h->min_ms)
+    {
+        h->min_ms = ms;
+    }
+    if (ms > h->max_ms)
+    {
+        h->max_ms = ms;
+    }
+    h->sum_ms += ms;
+    h->count++;
+    t2_event_d(latencies[lat].marker, (int)ms);
+    LanManagerInfo((" %s = %u ms \n", latencies[lat].marker, ms));
+}
+
+void LNM_TelemetryInit(void)
+{
+    memset(stage_ms, 0, sizeof(stage_ms));
+    LNM_TelemetryMark(LNM_STAGE_INIT);
+}
+
+void LNM_TelemetryMark(eLnmStage stage)
+{
+    uint64_t now = LNM_MonotonicMs();
+    int i;
+
+    if (stage < 0 || stage >= LNM_STAGE_MAX)
+    {
+        return;
+    }
+    stage_ms[stage] = now;
+    for (i = 0; i < LNM_LAT_MAX; i++)
+    {
+        LNM_LatencyDef *l = &latencies[i];
+
+        if (l->to == stage && l->armed)
+        {
+            Telemetry_Record((eLnmLatency)i, (uint32_t)(now - stage_ms[l->from]));
+            l->armed = 0;
+        }
+        if (l->from == stage && !(l->once && histograms[i].count != 0))
+        {
+            l->armed = 1;
+        }
+    }
+}
+
+const LNM_Histogram *LNM_TelemetryHistogram(eLnmLatency lat)
+{
+    return (lat >= 0 && lat < LNM_LAT_MAX) ? &histograms[lat] : NULL;
+}
+
+const char *LNM_TelemetryLatencyName(eLnmLatency lat)
+{
+    return (lat >= 0 && lat < LNM_LAT_MAX) ? latencies[lat].marker : "";
+}
+
+void LNM_TelemetryDump(void)
+{
+    int i;
+
+    for (i = 0; i < LNM_LAT_MAX; i++)
+    {
+        const LNM_Histogram *h = &histograms[i];
+
+        if (h->count != 0)
+        {
+            LanManagerInfo((" %s: count=%u min=%u avg=%u max=%u ms \n", latencies[i].marker,
+                            h->count, h->min_ms, (uint32_t)(h->sum_ms / h->count), h->max_ms));
+        }
+    }
+}
@@ -0,0 +1,226 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "lanmgr_daemon.h"
+#include "lanmgr_evloop.h"
+#include "lanmgr_log.h"
+#include "lanmgr_stats.h"
+#include "lanmgr_watchdog.h"
+
+typedef struct
+{
+    pthread_mutex_t  lock;
+    char             name[24];
+    uint64_t         since_ms;      /* 0 while idle */
+    unsigned int     deadline_ms;
+    int              reported;      /* overrun of the current work logged */
+    char             what[64];
+} LNM_WdThread;
+
+static LNM_WdThread threads[LNM_WD_MAX_THREADS];
+static int num_threads = 0;
+static pthread_mutex_t register_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread LNM_WdThread *self = NULL;
+static unsigned int check_ms = 0;
+static int keepalive = 0;
+static int check_armed = 0;         /* a check is scheduled */
+static int hung = 0;
+
+static void Watchdog_Check(void *arg);
+
+/* Without a service watchdog the check only runs while there is work:
+ * the first work to begin arms it, and it re-arms itself while any is
+ * left. */
+static void Watchdog_Arm(void)
+{
+    if (__atomic_exchange_n(&check_armed, 1, __ATOMIC_SEQ_CST))
+    {
+        return;
+    }
+    if (LNM_EvLoopAddTimer(LNM_WD_CHECK_MSECS, Watchdog_Check, NULL) < 0)
+    {
+        __atomic_store_n(&check_armed, 0, __ATOMIC_SEQ_CST);
+        LanManagerErrorRL((" cannot schedule the watchdog check \n"));
+    }
+}
+
+int LNM_WatchdogRegister(const char *name)
+{
+    LNM_WdThread *t = NULL;
+
+    pthread_mutex_lock(&register_lock);
+    if (num_threads < LNM_WD_MAX_THREADS)
+    {
+        t = &threads[num_threads];
+        pthread_mutex_init(&t->lock, NULL);
+        snprintf(t->name, sizeof(t->name), "%s", name);
+        /* published last, the check only looks at [0, num_threads) */
+        __atomic_store_n(&num_threads, num_threads + 1, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&register_lock);
+    if (t == NULL)
+    {
+        LanManagerError((" watchdog table full, %s is not watched \n", name));
+        return -1;
+    }
+    self = t;
+    return 0;
+}
+
+void LNM_WatchdogBegin(const char *what, unsigned int deadline_ms)
+{
+    LNM_WdThread *t = self;
+
+    if (t == NULL)
+    {
+        return;
+    }
+    pthread_mutex_lock(&t->lock);
+    snprintf(t->what, sizeof(t->what), "%s", what);
+    t->deadline_ms = deadline_ms ? deadline_ms : LNM_WD_DEFAULT_DEADLINE_MSECS;
+    t->reported = 0;
+    t->since_ms = LNM_MonotonicMs();
+    pthread_mutex_unlock(&t->lock);
+    /* a no-op while a check is scheduled, i.e. on every busy path */
+    if (!__atomic_load_n(&check_armed, __ATOMIC_SEQ_CST))
+    {
+        Watchdog_Arm();
+    }
+}
+
+void LNM_WatchdogEnd(void)
+{
+    LNM_WdThread *t = self;
+    uint64_t elapsed;
+
+    if (t == NULL)
+    {
+        return;
+    }
+    pthread_mutex_lock(&t->lock);
+    elapsed = LNM_MonotonicMs() - t->since_ms;
+    if (elapsed > t->deadline_ms && !t->reported)
+    {
+        LanManagerWarn((" %s: %s took %llu ms, deadline %u ms \n", t->name, t->what,
+                        (unsigned long long)elapsed, t->deadline_ms));
+        LNM_StatsInc(LNM_STAT_HANDLER_OVERRUNS);
+    }
+    t->since_ms = 0;
+    pthread_mutex_unlock(&t->lock);
+}
+
+/* Returns 1 if t is hung, counts it in busy if it is working. */
+static int Watchdog_CheckThread(LNM_WdThread *t, uint64_t now, int *busy)
+{
+    uint64_t elapsed;
+    int rc = 0;
+
+    pthread_mutex_lock(&t->lock);
+    if (t->since_ms != 0)
+    {
+        (*busy)++;
+        elapsed = now - t->since_ms;
+        if (elapsed > t->deadline_ms && !t->reported)
+        {
+            LanManagerError((" %s: %s running for %llu ms, deadline %u ms \n", t->name, t->what,
+                             (unsigned long long)elapsed, t->deadline_ms));
+            LNM_StatsInc(LNM_STAT_HANDLER_OVERRUNS);
+            t->reported = 1;
+        }
+        rc = elapsed > LNM_WD_HANG_MSECS;
+    }
+    pthread_mutex_unlock(&t->lock);
+    return rc;
+}
+
+static void Watchdog_Check(void *arg)
+{
+    uint64_t now = LNM_MonotonicMs();
+    int i, n, stuck = 0, busy = 0;
+
+    if (!keepalive)
+    {
+        /* disarmed before the scan: work that begins from here on either
+         * is seen below or arms the check itself */
+        __atomic_store_n(&check_armed, 0, __ATOMIC_SEQ_CST);
+    }
+    n = __atomic_load_n(&num_threads, __ATOMIC_ACQUIRE);
+    for (i = 0; i < n; i++)
+    {
+        stuck += Watchdog_CheckThread(&threads[i], now, &busy);
+    }
+    if (stuck != 0 && !hung)
+    {
+        LanManagerError((" %d thread(s) hung%s \n", stuck,
+                         keepalive ? ", withholding the service watchdog keep-alive" : ""));
+    }
+    else if (stuck == 0 && hung)
+    {
+        LanManagerInfo((" hung thread(s) recovered \n"));
+    }
+    hung = stuck != 0;
+    if (!keepalive)
+    {
+        if (busy != 0)
+        {
+            Watchdog_Arm();
+        }
+        return;
+    }
+    if (!hung)
+    {
+        LNM_DaemonNotify("WATCHDOG=1");
+    }
+    if (LNM_EvLoopAddTimer(check_ms, Watchdog_Check, NULL) < 0)
+    {
+        LanManagerError((" cannot schedule the watchdog check \n"));
+    }
+}
+
+int LNM_WatchdogStart(void)
+{
+    const char *usec = getenv("WATCHDOG_USEC");
+    const char *pid = getenv("WATCHDOG_PID");
+    unsigned long long period;
+
+    if (usec != NULL && (pid == NULL || atoi(pid) == (int)getpid()))
+    {
+        period = strtoull(usec, NULL, 10) / 1000;
+        if (period >= 2)
+        {
+            /* systemd recommends a keep-alive every half period */
+            check_ms = (unsigned int)(period / 2);
+            keepalive = 1;
+        }
+    }
+    if (!keepalive)
+    {
+        /* an idle lan_manager must not wake up, Begin() arms the check */
+        LanManagerInfo((" no service watchdog, checking every %u ms while busy \n", LNM_WD_CHECK_MSECS));
+        return 0;
+    }
+    /* the periodic check runs for good, Begin() must not add another */
+    __atomic_store_n(&check_armed, 1, __ATOMIC_SEQ_CST);
+    LanManagerInfo((" watchdog check every %u ms, keep-alive on \n", check_ms));
+    return LNM_EvLoopAddTimer(check_ms, Watchdog_Check, NULL) < 0 ? -1 : 0;
+}
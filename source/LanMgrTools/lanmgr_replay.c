@@ -0,0 +1,417 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+/*
+ * lan_manager_replay: print the event journal written by lan_manager, or
+ * turn one run of it into a lan_manager_bench script.
+ *
+ * The journal is read through a read-only mapping while lan_manager keeps
+ * appending to it. By default every complete record is printed with the
+ * time since the previous one, and a notification also shows the first
+ * set that followed it and how long that took.
+ *
+ * -s prints the run selected with -r (1, the default, is the latest) as a
+ * bench script. It holds the syscfg values lan_manager read, the values its
+ * sysevent gets returned as presets placed before the notification that
+ * led to them, and the notifications with their original spacing, each
+ * expecting the set it led to. lan_manager_bench then feeds them through
+ * the real handlers and reports their latency. -e prints the sets of the
+ * run as a bench .expected file, so -c checks that the replay issues the
+ * same sets in the same order as the device did.
+ */
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "lanmgr_journal.h"
+
+#define REPLAY_LINE_SIZE   192
+#define REPLAY_MAX_LINES   ( 2 * LNM_JOURNAL_SLOTS + 8 )
+#define REPLAY_MAX_VALUES  256
+
+typedef struct
+{
+    char  name[LNM_JOURNAL_NAME_SIZE];
+    char  val[LNM_JOURNAL_VAL_SIZE];
+} ReplayValue;
+
+typedef struct
+{
+    ReplayValue  v[REPLAY_MAX_VALUES];
+    int          n;
+} ReplayStore;
+
+static LNM_JournalRecord recs[LNM_JOURNAL_SLOTS];
+static int num_recs = 0;
+static char lines[REPLAY_MAX_LINES][REPLAY_LINE_SIZE];
+static int num_lines = 0;
+
+static const char *Replay_TypeName(uint8_t type)
+{
+    switch (type)
+    {
+    case LNM_JOURNAL_START:    return "start";
+    case LNM_JOURNAL_IN:       return "in";
+    case LNM_JOURNAL_GET:      return "get";
+    case LNM_JOURNAL_SET:      return "set";
+    case LNM_JOURNAL_SET_DONE: return "set-done";
+    case LNM_JOURNAL_CFG:      return "syscfg";
+    default:                   return "?";
+    }
+}
+
+/* Copy every complete record, oldest first. A record is skipped when its
+ * slot is being written or was reused by a later lap while copying. */
+static int Replay_Load(const char *path)
+{
+    const LNM_JournalFile *j;
+    struct stat st;
+    uint64_t head, idx;
+    int fd;
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        fprintf(stderr, "lan_manager_replay: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size != (off_t)sizeof(LNM_JournalFile))
+    {
+        fprintf(stderr, "lan_manager_replay: %s: not a journal\n", path);
+        close(fd);
+        return -1;
+    }
+    j = mmap(NULL, sizeof(LNM_JournalFile), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (j == MAP_FAILED)
+    {
+        fprintf(stderr, "lan_manager_replay: %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    if (__atomic_load_n(&j->magic, __ATOMIC_ACQUIRE) != LNM_JOURNAL_MAGIC ||
+        j->version != LNM_JOURNAL_VERSION || j->record_size != sizeof(LNM_JournalRecord) ||
+        j->slots != LNM_JOURNAL_SLOTS)
+    {
+        fprintf(stderr, "lan_manager_replay: %s: unknown format (magic 0x%x version %u)\n",
+                path, j->magic, j->version);
+        return -1;
+    }
+    head = __atomic_load_n(&j->head, __ATOMIC_ACQUIRE);
+    for (idx = head > LNM_JOURNAL_SLOTS ? head - LNM_JOURNAL_SLOTS : 0; idx < head; idx++)
+    {
+        const LNM_JournalRecord *r = &j->records[idx & (LNM_JOURNAL_SLOTS - 1)];
+        LNM_JournalRecord *c = &recs[num_recs];
+
+        if (__atomic_load_n(&r->seq, __ATOMIC_ACQUIRE) != idx + 1)
+        {
+            continue;
+        }
+        memcpy(c, r, sizeof(*c));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&r->seq, __ATOMIC_RELAXED) != idx + 1)
+        {
+            continue;
+        }
+        c->name[sizeof(c->name) - 1] = '\0';
+        c->val[sizeof(c->val) - 1] = '\0';
+        num_recs++;
+    }
+    munmap((void *)j, sizeof(LNM_JournalFile));
+    return 0;
+}
+
+/* Records [*from, *to) of run, 1 being the latest. Without a START in the
+ * ring the oldest run has lost its beginning and starts at record 0. */
+static int Replay_SelectRun(int run, int *from, int *to)
+{
+    int i, found = 0;
+
+    *to = num_recs;
+    for (i = num_recs - 1; i >= 0; i--)
+    {
+        if (recs[i].type == LNM_JOURNAL_START && ++found == run)
+        {
+            *from = i;
+            return 0;
+        }
+        if (recs[i].type == LNM_JOURNAL_START)
+        {
+            *to = i;
+        }
+    }
+    if (found == run - 1 && *to > 0)
+    {
+        *from = 0;
+        return 0;
+    }
+    return -1;
+}
+
+/* The first set after record i, before the next notification. */
+static const LNM_JournalRecord *Replay_FirstSet(int i, int to)
+{
+    for (i++; i < to && recs[i].type != LNM_JOURNAL_IN && recs[i].type != LNM_JOURNAL_START; i++)
+    {
+        if (recs[i].type == LNM_JOURNAL_SET)
+        {
+            return &recs[i];
+        }
+    }
+    return NULL;
+}
+
+static void Replay_Print(int from, int to)
+{
+    uint64_t prev = 0;
+    int i;
+
+    for (i = from; i < to; i++)
+    {
+        const LNM_JournalRecord *r = &recs[i];
+        const LNM_JournalRecord *s;
+
+        printf("%6llu.%06llu %+10.3f ms  %-8s %s", (unsigned long long)(r->ts_us / 1000000),
+               (unsigned long long)(r->ts_us % 1000000),
+               prev != 0 ? (double)(int64_t)(r->ts_us - prev) / 1000 : 0.0,
+               Replay_TypeName(r->type), r->name);
+        prev = r->ts_us;
+        switch (r->type)
+        {
+        case LNM_JOURNAL_START:
+            printf(" pid %d", r->arg);
+            break;
+        case LNM_JOURNAL_SET:
+            printf("=%s lane %d", r->val, r->arg);
+            break;
+        default:
+            printf("=%s", r->val);
+            if (r->arg != 0)
+            {
+                printf(" rc %d", r->arg);
+            }
+            break;
+        }
+        if (r->type == LNM_JOURNAL_IN && (s = Replay_FirstSet(i, to)) != NULL)
+        {
+            printf(" -> %s after %llu us", s->name, (unsigned long long)(s->ts_us - r->ts_us));
+        }
+        printf("\n");
+    }
+}
+
+/* Insert a script line before line pos, or append when pos is -1. */
+static int Replay_Insert(int pos, const char *line)
+{
+    if (num_lines == REPLAY_MAX_LINES)
+    {
+        return -1;
+    }
+    if (pos < 0)
+    {
+        pos = num_lines;
+    }
+    memmove(&lines[pos + 1], &lines[pos], (size_t)(num_lines - pos) * sizeof(lines[0]));
+    snprintf(lines[pos], sizeof(lines[0]), "%s", line);
+    num_lines++;
+    return pos;
+}
+
+/* Record name=val, return 1 if that changes what the store held. */
+static int Replay_Remember(ReplayStore *store, const char *name, const char *val)
+{
+    int i;
+
+    for (i = 0; i < store->n; i++)
+    {
+        if (strcmp(store->v[i].name, name) == 0)
+        {
+            if (strcmp(store->v[i].val, val) == 0)
+            {
+                return 0;
+            }
+            break;
+        }
+    }
+    if (i == store->n)
+    {
+        if (store->n == REPLAY_MAX_VALUES)
+        {
+            return 1;
+        }
+        store->n++;
+        snprintf(store->v[i].name, sizeof(store->v[i].name), "%s", name);
+    }
+    snprintf(store->v[i].val, sizeof(store->v[i].val), "%s", val);
+    return 1;
+}
+
+/* Bench scripts split on white space, treat '#' as a comment and "-" as
+ * the empty value. */
+static int Replay_Scriptable(const char *s)
+{
+    return strpbrk(s, " \t\r\n#") == NULL;
+}
+
+static const char *Replay_Value(const char *val)
+{
+    return val[0] != '\0' ? val : "-";
+}
+
+static int Replay_Script(const char *path, int run, int from, int to)
+{
+    static ReplayStore syscfg, sysevent;
+    uint64_t prev = recs[from].ts_us;
+    int event_line = -1;        /* line of the last notification */
+    int expecting = 0;          /* it has no expect yet */
+    int i;
+
+    printf("# lan_manager_replay -s -r %d %s\n", run, path);
+    for (i = from; i < to; i++)
+    {
+        const LNM_JournalRecord *r = &recs[i];
+        char line[REPLAY_LINE_SIZE];
+        int pos;
+
+        if (r->type != LNM_JOURNAL_START && (!Replay_Scriptable(r->name) || !Replay_Scriptable(r->val)))
+        {
+            snprintf(line, sizeof(line), "# %s %s: value \"%s\" cannot be scripted",
+                     Replay_TypeName(r->type), r->name, r->val);
+            Replay_Insert(-1, line);
+            continue;
+        }
+        switch (r->type)
+        {
+        case LNM_JOURNAL_CFG:
+        case LNM_JOURNAL_GET:
+            if (r->arg != 0 ||
+                !Replay_Remember(r->type == LNM_JOURNAL_CFG ? &syscfg : &sysevent, r->name, r->val))
+            {
+                break;
+            }
+            /* the value was there before the notification that read it */
+            snprintf(line, sizeof(line), "%s %s %s", r->type == LNM_JOURNAL_CFG ? "syscfg" : "preset",
+                     r->name, Replay_Value(r->val));
+            pos = Replay_Insert(event_line, line);
+            if (event_line >= 0 && pos >= 0)
+            {
+                event_line++;
+            }
+            break;
+        case LNM_JOURNAL_IN:
+            if (r->ts_us - prev >= 1000)
+            {
+                snprintf(line, sizeof(line), "wait %llu", (unsigned long long)((r->ts_us - prev) / 1000));
+                Replay_Insert(-1, line);
+            }
+            prev = r->ts_us;
+            Replay_Remember(&sysevent, r->name, r->val);
+            snprintf(line, sizeof(line), "event %s %s", r->name, Replay_Value(r->val));
+            event_line = Replay_Insert(-1, line);
+            expecting = event_line >= 0;
+            break;
+        case LNM_JOURNAL_SET:
+            Replay_Remember(&sysevent, r->name, r->val);
+            if (expecting)
+            {
+                size_t len = strlen(lines[event_line]);
+
+                snprintf(lines[event_line] + len, sizeof(lines[0]) - len, " expect %s", r->name);
+                expecting = 0;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    for (i = 0; i < num_lines; i++)
+    {
+        printf("%s\n", lines[i]);
+    }
+    return 0;
+}
+
+static void Replay_Expected(int from, int to)
+{
+    int i;
+
+    for (i = from; i < to; i++)
+    {
+        if (recs[i].type == LNM_JOURNAL_SET)
+        {
+            printf("set %s=%s\n", recs[i].name, recs[i].val);
+        }
+    }
+}
+
+static void Replay_Usage(void)
+{
+    fprintf(stderr, "usage: lan_manager_replay [-f file] [-r run] [-s | -e]\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = LNM_JOURNAL_FILE;
+    int run = 0, mode = 0, from = 0, to, opt;
+
+    while ((opt = getopt(argc, argv, "f:r:seh")) != -1)
+    {
+        switch (opt)
+        {
+        case 'f': path = optarg; break;
+        case 'r': run = atoi(optarg); break;
+        case 's':
+        case 'e': mode = opt; break;
+        default:  Replay_Usage(); return 2;
+        }
+    }
+    if (optind != argc || run < 0)
+    {
+        Replay_Usage();
+        return 2;
+    }
+    if (Replay_Load(path) != 0)
+    {
+        return 1;
+    }
+    to = num_recs;
+    /* printing shows every run unless one is asked for, scripts are one run */
+    if (run == 0 && mode != 0)
+    {
+        run = 1;
+    }
+    if (run != 0 && Replay_SelectRun(run, &from, &to) != 0)
+    {
+        fprintf(stderr, "lan_manager_replay: %s: no run %d\n", path, run);
+        return 1;
+    }
+    if (mode == 's')
+    {
+        return Replay_Script(path, run, from, to);
+    }
+    if (mode == 'e')
+    {
+        Replay_Expected(from, to);
+        return 0;
+    }
+    Replay_Print(from, to);
+    return 0;
+}
@@ -0,0 +1,206 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+/*
+ * lan_manager_stat: print the statistics page published by lan_manager.
+ *
+ * The page is read through a read-only mapping; nothing is sent to the
+ * daemon. Output is one "name value" pair per line so health scripts can
+ * consume it with awk. Exits 1 if the page is missing or not understood.
+ */
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "lanmgr_bringup.h"
+#include "lanmgr_stats.h"
+
+#define STAT_READ_RETRIES  1000
+
+static const char *const stat_names[LNM_STAT_MAX] = {
+    [LNM_STAT_SE_NOTIFICATIONS]     = "se_notifications",
+    [LNM_STAT_SE_ERRORS]            = "se_getnotification_errors",
+    [LNM_STAT_SE_RECONNECTS]        = "se_reconnects",
+    [LNM_STAT_EVENTS_UNKNOWN]       = "events_unknown",
+    [LNM_STAT_LAN_STARTS]           = "lan_starts",
+    [LNM_STAT_TRIGGERS_SUPPRESSED]  = "triggers_suppressed",
+    [LNM_STAT_HANDLER_OVERRUNS]     = "handler_overruns",
+    [LNM_STAT_PROC_RESTARTS]        = "proc_restarts",
+    [LNM_STAT_STATUS_REPEATS]       = "status_repeats",
+    [LNM_STAT_MODE_SWITCHES]        = "mode_switches",
+    [LNM_STAT_LOG_DROPPED]          = "log_dropped",
+};
+
+static const char *Stat_BringupName(uint32_t state)
+{
+    switch (state)
+    {
+    case LNM_BRINGUP_WAITING: return "waiting";
+    case LNM_BRINGUP_PENDING: return "pending";
+    case LNM_BRINGUP_STARTED: return "started";
+    case LNM_BRINGUP_STOPPED: return "stopped";
+    default:                  return "unknown";
+    }
+}
+
+/* Copy a consistent snapshot: retry while an update is in progress or the
+ * sequence moved under the copy. */
+static int Stat_ReadSnapshot(const LNM_StatsPage *page, LNM_StatsSnapshot *snap)
+{
+    uint32_t seq1, seq2;
+    int i;
+
+    for (i = 0; i < STAT_READ_RETRIES; i++)
+    {
+        seq1 = __atomic_load_n(&page->seq, __ATOMIC_ACQUIRE);
+        if (seq1 & 1)
+        {
+            sched_yield();
+            continue;
+        }
+        memcpy(snap, (const void *)&page->snap, sizeof(*snap));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        seq2 = __atomic_load_n(&page->seq, __ATOMIC_RELAXED);
+        if (seq1 == seq2)
+        {
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/* Queue depth and the enqueue to execution wait, the histogram as
+ * "executor.wait_us.<lower bound> <count>" for the buckets in use. */
+static void Stat_PrintExecutor(const LNM_ExecutorStats *exec)
+{
+    uint64_t executed = __atomic_load_n(&exec->executed, __ATOMIC_RELAXED);
+    uint64_t sum_wait = __atomic_load_n(&exec->sum_wait_us, __ATOMIC_RELAXED);
+    uint32_t count;
+    int i;
+
+    printf("executor.posted %llu\n", (unsigned long long)__atomic_load_n(&exec->posted, __ATOMIC_RELAXED));
+    printf("executor.executed %llu\n", (unsigned long long)executed);
+    printf("executor.depth %u\n", __atomic_load_n(&exec->depth, __ATOMIC_RELAXED));
+    printf("executor.max_depth %u\n", __atomic_load_n(&exec->max_depth, __ATOMIC_RELAXED));
+    printf("executor.stalls %llu\n", (unsigned long long)__atomic_load_n(&exec->stalls, __ATOMIC_RELAXED));
+    printf("executor.wait_avg_us %llu\n", (unsigned long long)(executed ? sum_wait / executed : 0));
+    printf("executor.wait_max_us %u\n", __atomic_load_n(&exec->max_wait_us, __ATOMIC_RELAXED));
+    printf("executor.run_max_us %u\n", __atomic_load_n(&exec->max_run_us, __ATOMIC_RELAXED));
+    for (i = 0; i < LNM_EXEC_WAIT_BUCKETS; i++)
+    {
+        count = __atomic_load_n(&exec->wait_buckets[i], __ATOMIC_RELAXED);
+        if (count != 0)
+        {
+            printf("executor.wait_us.%u %u\n", i ? 1u << (i - 1) : 0u, count);
+        }
+    }
+}
+
+static void Stat_Usage(void)
+{
+    fprintf(stderr, "usage: lan_manager_stat [-f file]\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = LNM_STATS_FILE;
+    const LNM_StatsPage *page;
+    LNM_StatsSnapshot snap;
+    struct timespec now;
+    struct stat st;
+    int fd, opt, i, running;
+
+    while ((opt = getopt(argc, argv, "f:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 'f': path = optarg; break;
+        default:  Stat_Usage(); return 2;
+        }
+    }
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        fprintf(stderr, "lan_manager_stat: %s: %s\n", path, strerror(errno));
+        return 1;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(LNM_StatsPage))
+    {
+        fprintf(stderr, "lan_manager_stat: %s: too short\n", path);
+        close(fd);
+        return 1;
+    }
+    page = mmap(NULL, sizeof(LNM_StatsPage), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (page == MAP_FAILED)
+    {
+        fprintf(stderr, "lan_manager_stat: %s: %s\n", path, strerror(errno));
+        return 1;
+    }
+    if (page->magic != LNM_STATS_MAGIC || page->version != LNM_STATS_VERSION ||
+        page->size != sizeof(LNM_StatsPage))
+    {
+        fprintf(stderr, "lan_manager_stat: %s: unknown format (magic 0x%x version %u)\n",
+                path, page->magic, page->version);
+        return 1;
+    }
+    if (Stat_ReadSnapshot(page, &snap) != 0)
+    {
+        fprintf(stderr, "lan_manager_stat: %s: snapshot kept changing\n", path);
+        return 1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    running = kill((pid_t)page->pid, 0) == 0 || errno == EPERM;
+
+    printf("pid %u\n", page->pid);
+    printf("running %d\n", running);
+    printf("started %lld\n", (long long)page->started);
+    printf("bringup_state %s\n", Stat_BringupName(snap.bringup_state));
+    printf("pnm_inited %u\n", snap.pnm_seen);
+    printf("netids_inited %u\n", snap.l3net_seen);
+    printf("bridge_mode %d\n", snap.bridge_mode);
+    printf("erouter_mode %d\n", snap.erouter_mode);
+    printf("last_lan_start %lld\n", (long long)snap.last_lan_start);
+    if (snap.last_lan_start_ms != 0)
+    {
+        uint64_t now_ms = (uint64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+
+        printf("last_lan_start_age_ms %llu\n", (unsigned long long)(now_ms - snap.last_lan_start_ms));
+    }
+    for (i = 0; i < LNM_STAT_MAX; i++)
+    {
+        printf("%s %llu\n", stat_names[i],
+               (unsigned long long)__atomic_load_n(&page->counters[i], __ATOMIC_RELAXED));
+    }
+    for (i = 0; i < LNM_STATS_EVENT_TYPES; i++)
+    {
+        if (page->event_names[i][0] != '\0')
+        {
+            printf("events.%.*s %llu\n", LNM_STATS_NAME_SIZE, page->event_names[i],
+                   (unsigned long long)__atomic_load_n(&page->events[i], __ATOMIC_RELAXED));
+        }
+    }
+    Stat_PrintExecutor(&page->exec);
+    return 0;
+}
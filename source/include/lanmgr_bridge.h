@@ -0,0 +1,94 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_BRIDGE_H_
+#define _LANMGR_BRIDGE_H_
+
+/**
+ * @brief Per-instance bridge table for the MULTILAN l3net instances.
+ *
+ * LNM_BridgeSync() diffs the current l3net_instances list against the
+ * instances already brought up and fires ipv4-up only for new instances or
+ * for ones whose previous ipv4-up failed. Instances are independent, each
+ * one gets its own set queue lane, and at most LNM_BRIDGE_MAX_INFLIGHT are
+ * outstanding at any time. The table and the list buffer grow as needed;
+ * in the low footprint mode they are allocated once at a fixed size.
+ */
+#define LNM_BRIDGE_MAX_INFLIGHT       4
+#define LNM_BRIDGE_LANE_BASE          0x10000
+#define LNM_BRIDGE_LIST_MIN_SIZE      256
+#define LNM_BRIDGE_LIST_MAX_SIZE      ( 64 * 1024 )
+#define LNM_BRIDGE_LOW_MAX_INSTANCES  64        /* low footprint mode */
+#define LNM_BRIDGE_LOW_LIST_SIZE      1024      /* low footprint mode */
+
+/**
+ * @brief Status of the LAN bridge (lan-status) and of the bridge mode
+ *        bridge (bridge-status).
+ *
+ * Only a change between "started" and "stopped" is an edge; the same
+ * status reported again, or an intermediate one such as "starting", is
+ * not. The last edge of each link is kept in the persisted state, so a
+ * restarted lan_manager does not take a repeated "started" for a new one.
+ */
+typedef enum
+{
+    LNM_LINK_LAN,
+    LNM_LINK_BRIDGE,
+    LNM_LINK_MAX
+} eLnmLink;
+
+typedef enum
+{
+    LNM_EDGE_NONE,
+    LNM_EDGE_UP,
+    LNM_EDGE_DOWN
+} eLnmEdge;
+
+/**
+ * @brief LNM_BridgeInit Allocate the fixed table and list buffer of the
+ *        low footprint mode. Without it both grow on demand.
+ * @param[in] low non zero in the low footprint mode
+ */
+void LNM_BridgeInit(int low);
+
+/**
+ * @brief LNM_BridgeSync Read l3net_instances and bring up what changed.
+ * @param[in] skip0 primary instance, already up, may be "" or NULL
+ * @param[in] skip1 home security instance, already up, may be "" or NULL
+ */
+void LNM_BridgeSync(const char *skip0, const char *skip1);
+
+/**
+ * @brief LNM_BridgeReset Forget every instance, e.g. when the LAN stopped,
+ *        so the next sync brings all of them up again.
+ */
+void LNM_BridgeReset(void);
+
+/**
+ * @brief LNM_BridgeStatus Record a status reported for link.
+ * @return the edge it makes, LNM_EDGE_NONE if it changes nothing
+ */
+eLnmEdge LNM_BridgeStatus(eLnmLink link, const char *status);
+
+/**
+ * @brief LNM_BridgeCount
+ * @return number of instances in the table
+ */
+unsigned int LNM_BridgeCount(void);
+
+#endif /* _LANMGR_BRIDGE_H_ */
@@ -0,0 +1,108 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_BRINGUP_H_
+#define _LANMGR_BRINGUP_H_
+
+/**
+ * @brief LAN bring-up state machine.
+ *
+ * The LAN is started once both the pnm trigger (bring-lan or pnm-status)
+ * and primary_lan_l3net have been seen. Every trigger carrying a new value
+ * bumps a generation counter; the LAN is started again only when the
+ * generation moved past the one last started, and triggers arriving
+ * within the coalescing window are folded into a single start. Triggers
+ * that change nothing are counted as suppressed, and not only within the
+ * window: for as long as the LAN stays up a repeat of the values it was
+ * started with starts nothing, be it minutes later or re-read after a
+ * sysevent reconnect, since every start restarts dnsmasq and the firewall.
+ * Once the LAN went down (LNM_BringupLinkEdge) the next trigger starts it
+ * again, changed or not; a LAN stopped without its status going down is
+ * only started again by a changed trigger.
+ *
+ * The trigger values and the values the LAN was last started with are kept
+ * in the persisted state (lanmgr_state.h) so a restart resumes from them.
+ */
+#define LNM_BRINGUP_DEFAULT_WINDOW_MSECS  100
+
+typedef enum
+{
+    LNM_BRINGUP_PNM,
+    LNM_BRINGUP_L3NET,
+    LNM_BRINGUP_TRIGGER_MAX
+} eLnmBringupTrigger;
+
+typedef enum
+{
+    LNM_BRINGUP_WAITING,    /* at least one trigger not seen yet */
+    LNM_BRINGUP_PENDING,    /* coalescing window running */
+    LNM_BRINGUP_STARTED,    /* LAN started for the current generation */
+    LNM_BRINGUP_STOPPED     /* LAN went down since, any trigger starts it */
+} eLnmBringupState;
+
+typedef void (*LNM_BringupStartFn)(void);
+
+/**
+ * @brief LNM_BringupInit
+ * @param[in] start     called on the executor to start the LAN
+ * @param[in] window_ms coalescing window, 0 starts immediately
+ */
+void LNM_BringupInit(LNM_BringupStartFn start, unsigned int window_ms);
+
+/**
+ * @brief LNM_BringupStartDone Report the result of the set issued by the
+ *        start function. A successful start is persisted so a restart does
+ *        not start the LAN again for the same triggers.
+ */
+void LNM_BringupStartDone(int rc);
+
+/**
+ * @brief LNM_BringupResume Continue from the persisted state: nothing
+ *        happens if the LAN was already started for the stored triggers,
+ *        a start is scheduled if both were seen but the LAN was not started
+ *        for them. Call once after LNM_BringupInit(), on the executor.
+ */
+void LNM_BringupResume(void);
+
+/**
+ * @brief LNM_BringupTrigger Record a trigger event and its value.
+ */
+void LNM_BringupTrigger(eLnmBringupTrigger trigger, const char *val);
+
+/**
+ * @brief LNM_BringupLinkEdge Report an edge of the link the LAN was started
+ *        on (lan-status in router mode, bridge-status otherwise).
+ * @param[in] up 1 for stopped -> started, 0 for started -> stopped
+ */
+void LNM_BringupLinkEdge(int up);
+
+/**
+ * @brief LNM_BringupSeen
+ * @return 1 if trigger has been received
+ */
+int LNM_BringupSeen(eLnmBringupTrigger trigger);
+
+eLnmBringupState LNM_BringupState(void);
+
+/**
+ * @brief LNM_BringupSuppressed
+ * @return number of triggers that did not cause a LAN start of their own
+ */
+unsigned int LNM_BringupSuppressed(void);
+
+#endif /* _LANMGR_BRINGUP_H_ */
@@ -0,0 +1,60 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_DAEMON_H_
+#define _LANMGR_DAEMON_H_
+
+/**
+ * @brief Process lifecycle helpers.
+ *
+ * A single instance guard based on an flock()ed pidfile, and the systemd
+ * notify protocol spoken directly over $NOTIFY_SOCKET so no libsystemd
+ * dependency is needed.
+ */
+#ifndef LNM_PID_FILE
+#define LNM_PID_FILE  "/var/run/lan_manager.pid"
+#endif
+
+/**
+ * @brief LNM_DaemonLock Take an exclusive lock on pidfile and write our pid
+ *        to it. The lock is held by the open descriptor until the process
+ *        exits, so a crashed instance never leaves a stale lock behind.
+ * @return 0 on success, 1 if another instance holds the lock, -1 on error
+ */
+int LNM_DaemonLock(const char *pidfile);
+
+/**
+ * @brief LNM_DaemonSupervised
+ * @return 1 if started by a service manager that expects notifications
+ */
+int LNM_DaemonSupervised(void);
+
+/**
+ * @brief LNM_DaemonNotify Send a state string such as "READY=1" to the
+ *        service manager. Does nothing when not supervised.
+ * @return 0 on success or when not supervised, -1 on failure
+ */
+int LNM_DaemonNotify(const char *state);
+
+/**
+ * @brief LNM_DaemonReady Report readiness and the startup footprint once;
+ *        later calls are ignored.
+ */
+void LNM_DaemonReady(void);
+
+#endif /* _LANMGR_DAEMON_H_ */
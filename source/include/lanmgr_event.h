@@ -0,0 +1,64 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_EVENT_H_
+#define _LANMGR_EVENT_H_
+
+#include "lanmgr_sysevent.h"
+
+/**
+ * @brief Event name to handler registry.
+ *
+ * Names are kept in an open addressing hash table (FNV-1a, linear probing)
+ * sized well above the number of events, so a lookup hashes the name once
+ * and normally compares a single entry no matter how many events exist.
+ * Every handler needs a notification, so there are as many as sysevent
+ * can subscribe.
+ */
+#define LNM_EVENT_MAX_HANDLERS  LNM_SE_MAX_NOTIFICATIONS
+#define LNM_EVENT_HASH_SIZE     64     /* power of two, >= 2 * LNM_EVENT_MAX_HANDLERS */
+
+typedef void (*LNM_EventHandler)(const char *name, const char *val);
+
+/**
+ * @brief LNM_EventRegister Map a sysevent name to a handler and subscribe
+ *        to its notification.
+ * @param[in] name        sysevent name
+ * @param[in] type        caller defined id, returned by LNM_EventLookup()
+ * @param[in] handler     called on the executor for every notification
+ * @param[in] deadline_ms run time after which the handler is reported as
+ *                        overrunning, 0 for the watchdog default
+ * @return 0 on success, -1 if the name is already registered, the table is
+ *         full or the notification cannot be subscribed; nothing is
+ *         registered then
+ */
+int LNM_EventRegister(const char *name, int type, LNM_EventHandler handler, unsigned int deadline_ms);
+
+/**
+ * @brief LNM_EventLookup
+ * @return the type registered for name, -1 if unknown
+ */
+int LNM_EventLookup(const char *name);
+
+/**
+ * @brief LNM_EventDispatch Run the handler registered for name.
+ *        Matches LNM_SyseventNotifyCb so it can be passed to LNM_SyseventInit().
+ */
+void LNM_EventDispatch(const char *name, const char *val);
+
+#endif /* _LANMGR_EVENT_H_ */
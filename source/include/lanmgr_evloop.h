@@ -0,0 +1,99 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_EVLOOP_H_
+#define _LANMGR_EVLOOP_H_
+
+#include <stdint.h>
+#include <sys/epoll.h>
+
+/**
+ * @brief Single threaded epoll event loop.
+ *
+ * File descriptors, one shot timers and signals are all dispatched from
+ * LNM_EvLoopRun(). Timers are backed by one timerfd which is only armed
+ * while at least one timer is pending, so an idle loop never wakes up.
+ * Timers may be added and cancelled from any thread, their callbacks run
+ * on the loop; every other call belongs to the loop thread.
+ */
+#define LNM_EV_MAX_FDS     16
+#define LNM_EV_MAX_TIMERS  32
+
+typedef void (*LNM_EvFdCb)(int fd, uint32_t events, void *arg);
+typedef void (*LNM_EvTimerCb)(void *arg);
+typedef void (*LNM_EvSignalCb)(int signo, void *arg);
+
+/**
+ * @brief LNM_EvLoopInit Create the epoll, timer and signal descriptors.
+ *        SIGTERM and SIGINT stop the loop. Must be called before any
+ *        thread is created so the blocked signal mask is inherited.
+ * @return 0 on success, -1 on failure
+ */
+int LNM_EvLoopInit(void);
+
+/**
+ * @brief LNM_EvLoopAddFd Watch fd for the given epoll events.
+ * @return 0 on success, -1 on failure
+ */
+int LNM_EvLoopAddFd(int fd, uint32_t events, LNM_EvFdCb cb, void *arg);
+
+/**
+ * @brief LNM_EvLoopDelFd Stop watching fd. Safe to call from the fd callback.
+ */
+void LNM_EvLoopDelFd(int fd);
+
+/**
+ * @brief LNM_EvLoopAddTimer Schedule a one shot timer.
+ * @return timer id (> 0) on success, -1 if the timer table is full
+ */
+int LNM_EvLoopAddTimer(unsigned int delay_ms, LNM_EvTimerCb cb, void *arg);
+
+/**
+ * @brief LNM_EvLoopCancelTimer Cancel a pending timer. Unknown ids are ignored.
+ */
+void LNM_EvLoopCancelTimer(int id);
+
+/**
+ * @brief LNM_EvLoopAddSignal Deliver signo through the loop instead of
+ *        asynchronously. Replaces any previous callback for signo.
+ * @return 0 on success, -1 on failure
+ */
+int LNM_EvLoopAddSignal(int signo, LNM_EvSignalCb cb, void *arg);
+
+/**
+ * @brief LNM_EvLoopRun Dispatch events until LNM_EvLoopStop() is called.
+ * @return 0 on a requested stop, -1 on a fatal epoll error
+ */
+int LNM_EvLoopRun(void);
+
+/**
+ * @brief LNM_EvLoopStop Make LNM_EvLoopRun() return after the current dispatch.
+ */
+void LNM_EvLoopStop(void);
+
+/**
+ * @brief LNM_MonotonicMs Current CLOCK_MONOTONIC time in milliseconds.
+ */
+uint64_t LNM_MonotonicMs(void);
+
+/**
+ * @brief LNM_MonotonicUs Current CLOCK_MONOTONIC time in microseconds.
+ */
+uint64_t LNM_MonotonicUs(void);
+
+#endif /* _LANMGR_EVLOOP_H_ */
@@ -0,0 +1,105 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_EXECUTOR_H_
+#define _LANMGR_EXECUTOR_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Action executor.
+ *
+ * The event loop only receives notifications and hands them over through a
+ * bounded lock-free single producer / single consumer queue. One executor
+ * thread runs the event handlers and everything else that touches handler
+ * state (deferred timers, set completions), so handlers never race each
+ * other and a slow action never delays the reception of the next event.
+ *
+ * Only the event loop thread may post. A full queue blocks the loop, which
+ * leaves further notifications queued in syseventd, as they were when the
+ * handlers ran inline.
+ */
+#define LNM_EXEC_QUEUE_DEPTH   128     /* power of two */
+#define LNM_EXEC_WAIT_BUCKETS  24      /* [0,1) [1,2) [2,4) ... [4194304,inf) us */
+
+typedef void (*LNM_ExecEventFn)(const char *name, const char *val);
+typedef void (*LNM_ExecFn)(void *arg);
+
+typedef struct
+{
+    /* receive stage */
+    uint64_t  posted;
+    uint32_t  depth;                /* items queued right now */
+    uint32_t  max_depth;
+    uint64_t  stalls;               /* posts that waited for a free slot */
+    /* executor stage */
+    uint64_t  executed;
+    uint32_t  max_wait_us;          /* enqueue to start of execution */
+    uint64_t  sum_wait_us;
+    uint32_t  max_run_us;
+    uint32_t  wait_buckets[LNM_EXEC_WAIT_BUCKETS];
+} LNM_ExecutorStats;
+
+/**
+ * @brief LNM_ExecutorInit Start the executor thread.
+ * @param[in] dispatch runs every posted event
+ * @return 0 on success, -1 on failure (posts then run inline on the caller)
+ */
+int LNM_ExecutorInit(LNM_ExecEventFn dispatch);
+
+/**
+ * @brief LNM_ExecutorStop Run everything already queued and stop the thread.
+ */
+void LNM_ExecutorStop(void);
+
+/**
+ * @brief LNM_ExecutorPostEvent Queue a notification for the dispatch function.
+ *        Matches LNM_SyseventNotifyCb.
+ */
+void LNM_ExecutorPostEvent(const char *name, const char *val);
+
+/**
+ * @brief LNM_ExecutorPost Queue fn(arg) on the executor.
+ */
+void LNM_ExecutorPost(LNM_ExecFn fn, void *arg);
+
+/**
+ * @brief LNM_ExecutorOnThread
+ * @return 1 if the caller runs what is posted to the executor, i.e. is the
+ *         executor thread or any thread while the executor is not running
+ */
+int LNM_ExecutorOnThread(void);
+
+/**
+ * @brief LNM_ExecutorAddTimer Run fn(arg) on the executor after delay_ms.
+ *        Callable from any thread.
+ * @return timer id (> 0) on success, -1 on failure
+ */
+int LNM_ExecutorAddTimer(unsigned int delay_ms, LNM_ExecFn fn, void *arg);
+
+/**
+ * @brief LNM_ExecutorGetStats Snapshot the queue metrics.
+ */
+void LNM_ExecutorGetStats(LNM_ExecutorStats *stats);
+
+/**
+ * @brief LNM_ExecutorDump Log a summary of the queue metrics.
+ */
+void LNM_ExecutorDump(void);
+
+#endif /* _LANMGR_EXECUTOR_H_ */
@@ -0,0 +1,102 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_FOOTPRINT_H_
+#define _LANMGR_FOOTPRINT_H_
+
+#include <pthread.h>
+#include <stdint.h>
+
+/**
+ * @brief Memory footprint control and the startup footprint report.
+ *
+ * Every thread is created by LNM_ThreadCreate() with an explicit
+ * LNM_THREAD_STACK_SIZE stack rather than the libc default of several MiB,
+ * which would all be resident once memory is locked.
+ *
+ * The low footprint mode, syscfg lan_manager_low_footprint=1, additionally
+ * keeps malloc to one arena that is never trimmed nor bypassed by mmap,
+ * leaves stdout unbuffered, and locks all pages with mlockall() so the
+ * resident set neither swaps nor faults. Tables that otherwise grow on
+ * demand, such as the MULTILAN bridge table, are allocated once at a fixed
+ * size, so the heap does not grow once the notifications are registered.
+ *
+ * Resident set, heap and the time from exec to "notifications registered"
+ * are logged and sent as t2 markers once, when the notifications are first
+ * registered, so releases can be compared.
+ */
+#ifndef LNM_THREAD_STACK_SIZE
+#define LNM_THREAD_STACK_SIZE  ( 128 * 1024 )
+#endif
+
+typedef struct
+{
+    uint32_t  rss_kb;
+    uint32_t  rss_peak_kb;
+    uint32_t  locked_kb;
+    uint32_t  heap_kb;          /* allocated */
+    uint32_t  heap_peak_kb;     /* obtained from the system, 0 if unknown */
+} LNM_Footprint;
+
+/**
+ * @brief LNM_FootprintInit Mark the start of main and apply the malloc and
+ *        stdio settings of the low footprint mode. Call before anything
+ *        else in main.
+ * @param[in] low non zero for the low footprint mode
+ */
+void LNM_FootprintInit(int low);
+
+/**
+ * @brief LNM_FootprintLow
+ * @return non zero in the low footprint mode
+ */
+int LNM_FootprintLow(void);
+
+/**
+ * @brief LNM_FootprintLock Lock current and future pages in the low
+ *        footprint mode. Call after daemonizing, locks are not inherited
+ *        across fork().
+ * @return 0 on success or when not in low footprint mode, -1 on failure
+ */
+int LNM_FootprintLock(void);
+
+/**
+ * @brief LNM_ThreadCreate pthread_create() with LNM_THREAD_STACK_SIZE.
+ * @return 0 on success, an error number otherwise
+ */
+int LNM_ThreadCreate(pthread_t *tid, void *(*fn)(void *), void *arg);
+
+/**
+ * @brief LNM_FootprintSample Read the current footprint.
+ */
+void LNM_FootprintSample(LNM_Footprint *fp);
+
+/**
+ * @brief LNM_FootprintReport Log and send the startup footprint and start
+ *        time. Only the first call reports, it also records the heap the
+ *        later dump compares against.
+ */
+void LNM_FootprintReport(void);
+
+/**
+ * @brief LNM_FootprintDump Log the footprint, and warn when the heap grew
+ *        since the startup report.
+ */
+void LNM_FootprintDump(void);
+
+#endif /* _LANMGR_FOOTPRINT_H_ */
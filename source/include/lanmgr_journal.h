@@ -0,0 +1,94 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_JOURNAL_H_
+#define _LANMGR_JOURNAL_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Binary journal of the sysevent traffic of lan_manager.
+ *
+ * Every notification received and every get, set and set completion, as
+ * well as the syscfg values read, is appended to a fixed size ring of
+ * records in a file on tmpfs, mapped shared, with its CLOCK_MONOTONIC time.
+ * Appending is a slot reservation with one atomic add and a copy into the
+ * mapping, no lock and no system call besides the vDSO clock. The ring is
+ * kept across restarts and a START record marks each one, so the events
+ * that led to a restart are still there afterwards.
+ *
+ * A record is complete when its seq equals its index + 1; readers skip
+ * records that are still zero or were overwritten by a later lap.
+ * lan_manager_replay prints a journal or turns it into a bench script.
+ */
+#ifndef LNM_JOURNAL_FILE
+#define LNM_JOURNAL_FILE  "/tmp/lan_manager.journal"
+#endif
+#define LNM_JOURNAL_MAGIC      0x4c4e4d4a      /* "LNMJ" */
+#define LNM_JOURNAL_VERSION    1
+#define LNM_JOURNAL_SLOTS      1024            /* power of two */
+#define LNM_JOURNAL_NAME_SIZE  40
+#define LNM_JOURNAL_VAL_SIZE   64
+
+typedef enum
+{
+    LNM_JOURNAL_START = 1,      /* lan_manager started, arg is the pid */
+    LNM_JOURNAL_IN,             /* notification received */
+    LNM_JOURNAL_GET,            /* sysevent_get, arg is the result */
+    LNM_JOURNAL_SET,            /* sysevent_set issued or queued, arg is the lane */
+    LNM_JOURNAL_SET_DONE,       /* sysevent_set returned, arg is the result */
+    LNM_JOURNAL_CFG             /* syscfg value in effect, arg is the syscfg_get result */
+} eLnmJournalType;
+
+typedef struct
+{
+    uint64_t  seq;              /* index + 1 once complete */
+    uint64_t  ts_us;            /* CLOCK_MONOTONIC */
+    uint8_t   type;             /* eLnmJournalType */
+    uint8_t   reserved[3];
+    int32_t   arg;
+    char      name[LNM_JOURNAL_NAME_SIZE];
+    char      val[LNM_JOURNAL_VAL_SIZE];
+} LNM_JournalRecord;
+
+typedef struct
+{
+    uint32_t           magic;
+    uint16_t           version;
+    uint16_t           record_size;
+    uint32_t           slots;
+    uint32_t           reserved;
+    uint64_t           head;    /* index of the next record */
+    LNM_JournalRecord  records[LNM_JOURNAL_SLOTS];
+} LNM_JournalFile;
+
+/**
+ * @brief LNM_JournalInit Map the journal file, keeping the records of a
+ *        previous run, and append a START record. Records appended before
+ *        are dropped.
+ * @return 0 on success, -1 if the journal is not written
+ */
+int LNM_JournalInit(const char *path);
+
+/**
+ * @brief LNM_JournalAppend Append a record, safe from any thread. name and
+ *        val are truncated to fit, val may be NULL.
+ */
+void LNM_JournalAppend(eLnmJournalType type, const char *name, const char *val, int32_t arg);
+
+#endif /* _LANMGR_JOURNAL_H_ */
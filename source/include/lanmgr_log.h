@@ -18,6 +18,7 @@
 */
 #include <stdbool.h>
 #include <stdarg.h>
+#include <stdint.h>
 #include "rdk_debug.h"
 
 /**
@@ -25,10 +26,33 @@
  */
 #define DEBUG_INI_NAME  "/etc/debug.ini"
 
+#define LANMANAGER_LOG_MODULE  "LOG.RDK.LANMANAGER"
+
+/**
+ * @brief Async logging ring. Producers format into a preallocated slot and
+ *        a drainer thread hands the records to rdk_logger.
+ */
+#define LNM_LOG_RING_SLOTS   256     /* power of two */
+#define LNM_LOG_RECORD_SIZE  256
+
 #define ARGS_EXTRACT(msg ...) msg
 
+/* Levels within the cached threshold skip straight to logging; the others
+ * ask rdk_logger again, as the level can be raised at run time, and are
+ * dropped before any formatting happens. */
+#define  LANMANAGER_LOG_ENABLED(level)  \
+    ((int)(level) <= lanmgr_log_threshold || LanManagerLogRecheck(level))
+
 #define  LANMANAGER_LOG(level, msg)  \
-    RDK_LOG(level,"LOG.RDK.LANMANAGER", ARGS_EXTRACT msg);
+    do { \
+        if (LANMANAGER_LOG_ENABLED(level)) \
+        { \
+            if (lanmgr_log_async) \
+                LanManagerLogAsync(level, ARGS_EXTRACT msg); \
+            else \
+                RDK_LOG(level, LANMANAGER_LOG_MODULE, ARGS_EXTRACT msg); \
+        } \
+    } while (0)
 
 #define LanManagerInfo(msg) LANMANAGER_LOG(RDK_LOG_INFO, msg)
 #define LanManagerWarn(msg) LANMANAGER_LOG(RDK_LOG_WARN, msg)
@@ -37,5 +61,74 @@
 #define LanManagerFatal(msg) LANMANAGER_LOG(RDK_LOG_FATAL, msg)
 #define LanManagerNotice(msg) LANMANAGER_LOG(RDK_LOG_NOTICE, msg)
 
+/**
+ * @brief Rate limited logging for paths that can repeat without bound.
+ *
+ * Every call site owns a token bucket on the monotonic clock: up to burst
+ * lines go out back to back, then one per interval_ms. The first line let
+ * through after a suppression is preceded by the number of lines dropped.
+ */
+#define LNM_LOG_RL_BURST           5
+#define LNM_LOG_RL_INTERVAL_MSECS  60000
+
+typedef struct
+{
+    uint64_t      refill_ms;    /* 0 until the first use */
+    unsigned int  tokens;
+    unsigned int  suppressed;
+} LNM_LogBucket;
+
+#define  LANMANAGER_LOG_RL(level, burst, interval_ms, msg)  \
+    do { \
+        static LNM_LogBucket lnm_log_bucket_; \
+        unsigned int lnm_log_suppressed_; \
+        if (LANMANAGER_LOG_ENABLED(level) && \
+            LanManagerLogAllow(&lnm_log_bucket_, burst, interval_ms, &lnm_log_suppressed_)) \
+        { \
+            if (lnm_log_suppressed_ != 0) \
+                LANMANAGER_LOG(level, ("%s:%d: %u similar line(s) suppressed\n", __FILE__, __LINE__, lnm_log_suppressed_)); \
+            LANMANAGER_LOG(level, msg); \
+        } \
+    } while (0)
+
+#define LanManagerInfoRL(msg) LANMANAGER_LOG_RL(RDK_LOG_INFO, LNM_LOG_RL_BURST, LNM_LOG_RL_INTERVAL_MSECS, msg)
+#define LanManagerWarnRL(msg) LANMANAGER_LOG_RL(RDK_LOG_WARN, LNM_LOG_RL_BURST, LNM_LOG_RL_INTERVAL_MSECS, msg)
+#define LanManagerErrorRL(msg) LANMANAGER_LOG_RL(RDK_LOG_ERROR, LNM_LOG_RL_BURST, LNM_LOG_RL_INTERVAL_MSECS, msg)
+
+extern int lanmgr_log_threshold;
+extern volatile int lanmgr_log_async;
+
 bool LanManagerLogInit();
 bool LanManagerLogDeinit();
+
+/**
+ * @brief LanManagerLogRecheck Ask rdk_logger whether a level the cached
+ *        threshold filters is enabled now, and raise the threshold if so.
+ *        Used by LANMANAGER_LOG_ENABLED.
+ */
+bool LanManagerLogRecheck(int level);
+
+/**
+ * @brief LanManagerLogAsyncStart Route logs through the ring and start the drainer.
+ */
+bool LanManagerLogAsyncStart(void);
+
+/**
+ * @brief LanManagerLogAsyncStop Drain the ring and return to synchronous logging.
+ */
+void LanManagerLogAsyncStop(void);
+
+/**
+ * @brief LanManagerLogAsync Queue one record. Never blocks or allocates;
+ *        the record is dropped and counted (LNM_STAT_LOG_DROPPED) when the
+ *        ring is full. Logs synchronously once async mode was stopped.
+ */
+void LanManagerLogAsync(int level, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+/**
+ * @brief LanManagerLogAllow Take a token from bucket. Used by LANMANAGER_LOG_RL.
+ * @param[out] suppressed lines refused since the last allowed one, valid if allowed
+ * @return true if the line may be logged
+ */
+bool LanManagerLogAllow(LNM_LogBucket *bucket, unsigned int burst, unsigned int interval_ms,
+                        unsigned int *suppressed);
@@ -0,0 +1,60 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_PROC_H_
+#define _LANMGR_PROC_H_
+
+/**
+ * @brief Supervised helper processes.
+ *
+ * Helpers are started with posix_spawn() and an explicit argv, no shell
+ * involved, and must stay in the foreground. Exits are picked up from
+ * SIGCHLD on the event loop; only pids started here are reaped, so the
+ * children of v_secure_system() are left to their own waitpid(). A helper
+ * that exits is started again after a backoff that doubles from
+ * LNM_PROC_BACKOFF_MIN_MSECS up to LNM_PROC_BACKOFF_MAX_MSECS, and goes
+ * back to the minimum once a run lasted LNM_PROC_STABLE_MSECS.
+ */
+#define LNM_PROC_MAX                4
+#define LNM_PROC_MAX_ARGS           8
+#define LNM_PROC_ARGS_SIZE          256     /* all argument strings together */
+#define LNM_PROC_BACKOFF_MIN_MSECS  1000
+#define LNM_PROC_BACKOFF_MAX_MSECS  60000
+#define LNM_PROC_STABLE_MSECS       30000
+
+/**
+ * @brief LNM_ProcInit Route SIGCHLD through the event loop. Like
+ *        LNM_EvLoopInit() it must run before any thread is created.
+ * @return 0 on success, -1 on failure
+ */
+int LNM_ProcInit(void);
+
+/**
+ * @brief LNM_ProcStart Start name and keep it running. Safe from any thread.
+ * @param[in] argv NULL terminated, argv[0] is the absolute path; copied,
+ *            at most LNM_PROC_MAX_ARGS and LNM_PROC_ARGS_SIZE bytes
+ * @return 0 if supervision started, 1 if name is supervised already, -1 on error
+ */
+int LNM_ProcStart(const char *name, char *const argv[]);
+
+/**
+ * @brief LNM_ProcStopAll Stop restarting and send SIGTERM to every helper.
+ */
+void LNM_ProcStopAll(void);
+
+#endif /* _LANMGR_PROC_H_ */
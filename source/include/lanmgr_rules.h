@@ -0,0 +1,95 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_RULES_H_
+#define _LANMGR_RULES_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Declarative reactions to LAN lifecycle triggers.
+ *
+ * Each rule names a trigger, the platform profile bits it needs or must not
+ * see, an optional syscfg guard and the sysevent to set. The profile
+ * replaces the per platform #ifdefs: it defaults to what the build was
+ * configured for and can be overridden at startup with the
+ * lan_manager_profile syscfg key, so one binary serves several platforms.
+ * LNM_RulesInit() keeps the rules of the active profile in one flat array
+ * ordered by trigger, so firing a trigger walks only its own rules, in
+ * table order.
+ */
+#define LNM_RULES_MAX  32
+
+/* Profile bits */
+#define LNM_PROFILE_PNM_STATUS     0x01    /* bring-up is announced by pnm-status, not bring-lan */
+#define LNM_PROFILE_EXT_HOTSPOT    0x02    /* hotspot-start is issued by platform scripts */
+#define LNM_PROFILE_MULTILAN       0x04
+#define LNM_PROFILE_HOME_SECURITY  0x08
+#define LNM_PROFILE_LNF            0x10    /* lost and found network set up on LAN start */
+#define LNM_PROFILE_LNF_SWITCH     0x20    /* ... unless lost_and_found_enable is false */
+#define LNM_PROFILE_CISCOCONNECT   0x40
+#define LNM_PROFILE_DSLITE         0x80
+
+typedef enum
+{
+    LNM_RULE_LAN_START,         /* LAN_start() issued lan-start / bridge-start */
+    LNM_RULE_LAN_STARTED,       /* lan-status started */
+    LNM_RULE_TRIGGER_MAX
+} eLnmRuleTrigger;
+
+typedef struct
+{
+    eLnmRuleTrigger  trigger;
+    uint32_t         require;       /* every one of these profile bits */
+    uint32_t         exclude;       /* none of these */
+    const char      *guard_val;     /* NULL for no guard */
+    int              guard_cfg;     /* eLnmCfgKey compared with guard_val */
+    int              guard_not;     /* guard holds when the key differs from guard_val */
+    uint32_t         once;          /* persisted state flag, 0 to fire every time */
+    const char      *set_name;
+    const char      *set_val;       /* literal value ... */
+    const char      *set_val_from;  /* ... or the value of this sysevent, skipped if empty */
+    unsigned int     lane;
+} LNM_Rule;
+
+/**
+ * @brief LNM_RulesInit Pick the profile and keep the rules it enables.
+ * @param[in] rules table in firing order, must outlive the process
+ * @return the active profile
+ */
+uint32_t LNM_RulesInit(const LNM_Rule *rules, unsigned int num_rules);
+
+/**
+ * @brief LNM_RulesProfile
+ * @return the active profile
+ */
+uint32_t LNM_RulesProfile(void);
+
+/**
+ * @brief LNM_RulesProfileMatch
+ * @return 1 if the active profile has every bit of require and none of exclude
+ */
+int LNM_RulesProfileMatch(uint32_t require, uint32_t exclude);
+
+/**
+ * @brief LNM_RulesFire Evaluate every rule of trigger and queue its set.
+ * @return number of sets queued
+ */
+unsigned int LNM_RulesFire(eLnmRuleTrigger trigger);
+
+#endif /* _LANMGR_RULES_H_ */
@@ -0,0 +1,67 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_SETQ_H_
+#define _LANMGR_SETQ_H_
+
+/**
+ * @brief Outbound sysevent_set queue.
+ *
+ * Sets are queued by the event loop and issued by a small pool of writer
+ * threads, each on its own sysevent session, so a slow syseventd never
+ * delays the reception of the next notification. Every command belongs to
+ * a lane: commands of one lane are issued strictly in queue order, one at
+ * a time, while different lanes may be issued concurrently. Completions
+ * are reported back on the executor. A full queue makes the caller wait
+ * for a slot; on the executor the completions already there are reported
+ * first, from within the call.
+ */
+#define LNM_SETQ_DEPTH            64
+#define LNM_SETQ_MAX_WORKERS      4
+#define LNM_SETQ_DEFAULT_WORKERS  2
+#define LNM_SETQ_LANE_ORDERED     0
+#define LNM_SETQ_SET_DEADLINE_MSECS  2000  /* watchdog deadline of one sysevent_set */
+
+typedef void (*LNM_SetDoneCb)(unsigned int seq, int rc, void *arg);
+
+/**
+ * @brief LNM_SetQueueInit Start the writers and watch their completions
+ *        from the event loop.
+ * @param[in] workers number of writer threads, 1..LNM_SETQ_MAX_WORKERS
+ * @return 0 on success, -1 on failure (sets are then issued synchronously)
+ */
+int LNM_SetQueueInit(int workers);
+
+/**
+ * @brief LNM_SetQueueStop Issue every queued set and stop the writers.
+ *        Call after LNM_ExecutorStop(), remaining completions are then
+ *        reported on the caller.
+ */
+void LNM_SetQueueStop(void);
+
+/**
+ * @brief LNM_SyseventSetAsync Queue a sysevent_set.
+ * @param[in] lane commands sharing a lane are issued in order
+ * @param[in] done optional, called on the executor with the sysevent_set
+ *            result. Failures are logged whether or not done is given.
+ * @return the command sequence number, never 0
+ */
+unsigned int LNM_SyseventSetAsync(const char *name, const char *val, unsigned int lane,
+                                  LNM_SetDoneCb done, void *arg);
+
+#endif /* _LANMGR_SETQ_H_ */
@@ -0,0 +1,109 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_STATE_H_
+#define _LANMGR_STATE_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Bring-up state that survives a restart of lan_manager.
+ *
+ * The state lives in a small versioned file on tmpfs, mapped shared, so
+ * every update is in the page cache the moment it is made and a restarted
+ * instance picks up where the previous one stopped. tmpfs starts empty on
+ * every boot. Updates are bracketed by a sequence counter which is odd
+ * while one is in progress; a file left odd, or with another magic, version
+ * or size, is discarded.
+ */
+#ifndef LNM_STATE_FILE
+#define LNM_STATE_FILE  "/tmp/lan_manager.state"
+#endif
+#define LNM_STATE_MAGIC     0x4c4e4d53      /* "LNMS" */
+#define LNM_STATE_VERSION   2
+#define LNM_STATE_TRIGGERS  2               /* LNM_BRINGUP_TRIGGER_MAX */
+#define LNM_STATE_VAL_SIZE  64
+
+/* flags */
+#define LNM_STATE_LAN_STARTED           0x1     /* LAN_start issued for started_val */
+#define LNM_STATE_HOTSPOT_STARTED       0x2
+#define LNM_STATE_CISCOCONNECT_STARTED  0x8
+#define LNM_STATE_LAN_UP                0x10    /* last lan-status edge was started */
+#define LNM_STATE_BRIDGE_UP             0x20    /* last bridge-status edge was started */
+
+typedef struct
+{
+    uint32_t  seen;
+    char      val[LNM_STATE_VAL_SIZE];
+    char      started_val[LNM_STATE_VAL_SIZE];  /* value the LAN was last started with */
+} LNM_StateTrigger;
+
+typedef struct
+{
+    uint32_t          magic;
+    uint16_t          version;
+    uint16_t          size;
+    uint32_t          seq;
+    uint32_t          flags;
+    uint32_t          lan_mode;     /* mode the LAN was started in, 0 if unknown */
+    LNM_StateTrigger  triggers[LNM_STATE_TRIGGERS];    /* by eLnmBringupTrigger */
+} LNM_PersistState;
+
+/**
+ * @brief LNM_StateInit Map the state file, creating or resetting it when it
+ *        does not hold a valid state. Falls back to process memory when the
+ *        file cannot be used.
+ * @return 1 if a previous state was restored, 0 if the state starts empty
+ */
+int LNM_StateInit(const char *path);
+
+/**
+ * @brief LNM_StateGet
+ * @return the current state, never NULL
+ */
+const LNM_PersistState *LNM_StateGet(void);
+
+/**
+ * @brief LNM_StateBegin Open an update. Every change to the state must sit
+ *        between LNM_StateBegin() and LNM_StateCommit().
+ * @return the state to modify
+ */
+LNM_PersistState *LNM_StateBegin(void);
+
+/**
+ * @brief LNM_StateCommit Close the update opened by LNM_StateBegin().
+ */
+void LNM_StateCommit(void);
+
+/**
+ * @brief LNM_StateFlag
+ * @return non zero if flag is set
+ */
+int LNM_StateFlag(uint32_t flag);
+
+/**
+ * @brief LNM_StateSetFlag Set flag in its own update.
+ */
+void LNM_StateSetFlag(uint32_t flag);
+
+/**
+ * @brief LNM_StateClearFlag Clear flag in its own update.
+ */
+void LNM_StateClearFlag(uint32_t flag);
+
+#endif /* _LANMGR_STATE_H_ */
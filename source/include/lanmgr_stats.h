@@ -0,0 +1,129 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_STATS_H_
+#define _LANMGR_STATS_H_
+
+#include <stdint.h>
+#include "lanmgr_executor.h"
+
+/**
+ * @brief Read-only statistics page for lan_manager_stat and health scripts.
+ *
+ * A single page on /dev/shm, mapped shared and world readable. Counters are
+ * updated with relaxed atomic adds. The snapshot fields change together and
+ * are written under a sequence lock: the sequence is odd while an update is
+ * in progress, so a reader copies the snapshot, rechecks the sequence and
+ * retries if it moved. The executor metrics are single fields, each stored
+ * atomically by the one stage that owns it. Readers never signal or wake
+ * the daemon.
+ */
+#ifndef LNM_STATS_FILE
+#define LNM_STATS_FILE  "/dev/shm/lan_manager.stats"
+#endif
+#define LNM_STATS_MAGIC        0x4c4e4d43      /* "LNMC" */
+#define LNM_STATS_VERSION      7
+#define LNM_STATS_EVENT_TYPES  8
+#define LNM_STATS_NAME_SIZE    24
+
+typedef enum
+{
+    LNM_STAT_SE_NOTIFICATIONS,      /* notifications received */
+    LNM_STAT_SE_ERRORS,             /* sysevent_getnotification failures */
+    LNM_STAT_SE_RECONNECTS,         /* notification sessions opened after the first */
+    LNM_STAT_EVENTS_UNKNOWN,        /* notifications without a handler */
+    LNM_STAT_LAN_STARTS,            /* LAN_start() runs */
+    LNM_STAT_TRIGGERS_SUPPRESSED,   /* bring-up triggers that started nothing */
+    LNM_STAT_HANDLER_OVERRUNS,      /* work that ran past its watchdog deadline */
+    LNM_STAT_PROC_RESTARTS,         /* supervised helpers started again */
+    LNM_STAT_STATUS_REPEATS,        /* lan-status / bridge-status without a change */
+    LNM_STAT_MODE_SWITCHES,         /* bridge / router transitions issued */
+    LNM_STAT_LOG_DROPPED,           /* log records lost to a full ring */
+    LNM_STAT_MAX
+} eLnmStat;
+
+typedef struct
+{
+    uint32_t  bringup_state;        /* eLnmBringupState */
+    uint32_t  pnm_seen;
+    uint32_t  l3net_seen;
+    int32_t   bridge_mode;
+    int32_t   erouter_mode;
+    uint32_t  reserved;
+    int64_t   last_lan_start;       /* CLOCK_REALTIME seconds, 0 if never */
+    uint64_t  last_lan_start_ms;    /* CLOCK_MONOTONIC milliseconds */
+} LNM_StatsSnapshot;
+
+typedef struct
+{
+    uint32_t           magic;
+    uint16_t           version;
+    uint16_t           size;
+    uint32_t           pid;
+    uint32_t           seq;
+    int64_t            started;     /* CLOCK_REALTIME seconds */
+    uint64_t           counters[LNM_STAT_MAX];
+    uint64_t           events[LNM_STATS_EVENT_TYPES];      /* by event type */
+    char               event_names[LNM_STATS_EVENT_TYPES][LNM_STATS_NAME_SIZE];
+    LNM_StatsSnapshot  snap;
+    LNM_ExecutorStats  exec;        /* queue depth and wait times */
+} LNM_StatsPage;
+
+/**
+ * @brief LNM_StatsInit Create the statistics page at path. Falls back to
+ *        process memory when the file cannot be used.
+ * @return 0 if the page is published, -1 otherwise
+ */
+int LNM_StatsInit(const char *path);
+
+/**
+ * @brief LNM_StatsInc Add one to a counter. Safe from any thread.
+ */
+void LNM_StatsInc(eLnmStat stat);
+
+/**
+ * @brief LNM_StatsEvent Count one notification of the given event type.
+ *        Types outside [0, LNM_STATS_EVENT_TYPES) are ignored.
+ */
+void LNM_StatsEvent(int type);
+
+/**
+ * @brief LNM_StatsEventName Name the counter of an event type.
+ */
+void LNM_StatsEventName(int type, const char *name);
+
+/**
+ * @brief LNM_StatsExecutor The executor metrics on the page. Fields are
+ *        read and written with __atomic builtins only.
+ */
+LNM_ExecutorStats *LNM_StatsExecutor(void);
+
+/**
+ * @brief LNM_StatsBegin Open a snapshot update. Every change to the snapshot
+ *        must sit between LNM_StatsBegin() and LNM_StatsCommit(); updates
+ *        from different threads are serialised.
+ * @return the snapshot to modify
+ */
+LNM_StatsSnapshot *LNM_StatsBegin(void);
+
+/**
+ * @brief LNM_StatsCommit Close the update opened by LNM_StatsBegin().
+ */
+void LNM_StatsCommit(void);
+
+#endif /* _LANMGR_STATS_H_ */
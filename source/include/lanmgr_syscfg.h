@@ -0,0 +1,94 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_SYSCFG_H_
+#define _LANMGR_SYSCFG_H_
+
+/**
+ * @brief In-process cache of the syscfg keys lan_manager reads.
+ *
+ * All keys are loaded in one batch. A key is read from syscfg again only
+ * when
+ *  - the sysevent announcing its change is received (LNM_SysCfgCacheNotify),
+ *  - the syscfg database file was committed since the last load,
+ *  - the sysevent session was re-established, as notifications may have
+ *    been missed meanwhile, or
+ *  - it has no such sysevent and LNM_SysCfgCacheRefresh() is called, as a
+ *    syscfg_set that is not committed leaves the database file alone.
+ *
+ * The database file is LNM_SYSCFG_DB_FILE when configured with
+ * --with-syscfg-db, otherwise the first of LNM_SYSCFG_DB_PATHS that exists.
+ */
+#define LNM_SYSCFG_DB_PATHS  "/opt/secure/data/syscfg.db", "/nvram/syscfg.db"
+
+typedef enum
+{
+    LNM_CFG_BRIDGE_MODE,
+    LNM_CFG_LAST_EROUTER_MODE,
+    LNM_CFG_4_TO_6_ENABLED,
+    LNM_CFG_LOST_AND_FOUND_ENABLE,
+    LNM_CFG_LAN_START_COALESCE_MS,
+    LNM_CFG_LAN_MANAGER_PROFILE,
+    LNM_CFG_LOW_FOOTPRINT,
+    LNM_CFG_FACTORY_MODE,
+    LNM_CFG_MAX
+} eLnmCfgKey;
+
+/**
+ * @brief LNM_SysCfgCacheInit Load every cached key.
+ */
+void LNM_SysCfgCacheInit(void);
+
+/**
+ * @brief LNM_SysCfgPeekInt Read a key straight from syscfg, bypassing the
+ *        cache, without logging or journaling it. For main() before the
+ *        logger is set up.
+ * @return the key as an integer, -1 if it could not be read from syscfg
+ */
+int LNM_SysCfgPeekInt(eLnmCfgKey key);
+
+/**
+ * @brief LNM_SysCfgCacheGetInt
+ * @return the key as an integer, -1 if it could not be read from syscfg
+ */
+int LNM_SysCfgCacheGetInt(eLnmCfgKey key);
+
+/**
+ * @brief LNM_SysCfgCacheGetStr
+ * @return the key as a string, "" if it could not be read from syscfg
+ */
+const char *LNM_SysCfgCacheGetStr(eLnmCfgKey key);
+
+/**
+ * @brief LNM_SysCfgCacheNotify Invalidate the keys changed by sysevent name.
+ * @return 1 if any key was invalidated
+ */
+int LNM_SysCfgCacheNotify(const char *name);
+
+/**
+ * @brief LNM_SysCfgCacheRefresh Force the keys without a change sysevent
+ *        to be read again on next use.
+ */
+void LNM_SysCfgCacheRefresh(void);
+
+/**
+ * @brief LNM_SysCfgCacheInvalidate Force key to be read again on next use.
+ */
+void LNM_SysCfgCacheInvalidate(eLnmCfgKey key);
+
+#endif /* _LANMGR_SYSCFG_H_ */
@@ -0,0 +1,80 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_SYSEVENT_H_
+#define _LANMGR_SYSEVENT_H_
+
+/**
+ * @brief sysevent connection manager.
+ *
+ * Owns the sysevent session used for notifications. A dead session (socket
+ * hang-up or a failed sysevent_getnotification) is closed and reopened with
+ * bounded exponential backoff plus jitter, and every subscribed notification
+ * is registered again on the new session. As notifications sent meanwhile
+ * are lost, the current value of every subscribed event is then delivered
+ * to the notification callback. Gets and sets go through a separate
+ * request session that any thread may use.
+ */
+#define LNM_SE_MAX_NOTIFICATIONS  16
+#define LNM_SE_BACKOFF_MIN_MSECS  10
+#define LNM_SE_BACKOFF_MAX_MSECS  ( 5 * 1000 )
+
+typedef void (*LNM_SyseventNotifyCb)(const char *name, const char *val);
+
+/**
+ * @brief LNM_SyseventInit Open the session and start watching it from the
+ *        event loop. If syseventd is not reachable yet the connection is
+ *        retried in the background.
+ * @param[in] cb called for every notification received
+ * @return 0 on success, -1 on invalid arguments
+ */
+int LNM_SyseventInit(LNM_SyseventNotifyCb cb);
+
+/**
+ * @brief LNM_SyseventSubscribe Add name to the notification set. It is
+ *        registered immediately when connected and after every reconnect.
+ * @return 0 on success, -1 if the set is full
+ */
+int LNM_SyseventSubscribe(const char *name);
+
+/**
+ * @brief LNM_SyseventConnected
+ * @return 1 if a session is open and all notifications are registered
+ */
+int LNM_SyseventConnected(void);
+
+/**
+ * @brief LNM_SyseventSession
+ * @return a counter bumped on every successful (re)connect. Notifications
+ *         may have been missed whenever it changes.
+ */
+unsigned int LNM_SyseventSession(void);
+
+/**
+ * @brief LNM_SyseventGet sysevent_get on the request session. Thread safe.
+ * @return 0 on success, non zero on failure (buf is then an empty string)
+ */
+int LNM_SyseventGet(const char *name, char *buf, int buflen);
+
+/**
+ * @brief LNM_SyseventSet sysevent_set on the request session. Thread safe.
+ * @return 0 on success, non zero on failure
+ */
+int LNM_SyseventSet(const char *name, const char *val);
+
+#endif /* _LANMGR_SYSEVENT_H_ */
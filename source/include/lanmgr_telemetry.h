@@ -0,0 +1,96 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_TELEMETRY_H_
+#define _LANMGR_TELEMETRY_H_
+
+#include <stdint.h>
+
+/**
+ * @brief LAN bring-up latency instrumentation.
+ *
+ * Stages of the bring-up critical path are marked with CLOCK_MONOTONIC
+ * timestamps. Each latency between two stages is sent as a t2 split marker
+ * and added to a log2 millisecond histogram kept in memory.
+ */
+#define LNM_HIST_BUCKETS  16    /* [0,1) [1,2) [2,4) ... [16384,inf) ms */
+
+typedef enum
+{
+    LNM_STAGE_INIT,             /* lan_manager initialised */
+    LNM_STAGE_PNM,              /* bring-lan / pnm-status received */
+    LNM_STAGE_L3NET,            /* primary_lan_l3net received */
+    LNM_STAGE_TRIGGERED,        /* both triggers seen, LAN start scheduled */
+    LNM_STAGE_LAN_START,        /* LAN_start() entered */
+    LNM_STAGE_LAN_START_SET,    /* lan-start / bridge-start set completed */
+    LNM_STAGE_LAN_STARTED,      /* lan-status started received */
+    LNM_STAGE_MODE_CHANGE,      /* bridge_mode / erouter_mode-updated changed the mode */
+    LNM_STAGE_MODE_SWITCHED,    /* lan-start / bridge-start of the transition completed */
+    LNM_STAGE_MAX
+} eLnmStage;
+
+typedef enum
+{
+    LNM_LAT_INIT_TO_PNM,
+    LNM_LAT_INIT_TO_L3NET,
+    LNM_LAT_TRIGGER_TO_LAN_START,
+    LNM_LAT_LAN_START_TO_SET,
+    LNM_LAT_SET_TO_LAN_STARTED,
+    LNM_LAT_INIT_TO_LAN_STARTED,
+    LNM_LAT_MODE_SWITCH,
+    LNM_LAT_MAX
+} eLnmLatency;
+
+typedef struct
+{
+    uint32_t  count;
+    uint32_t  min_ms;
+    uint32_t  max_ms;
+    uint64_t  sum_ms;
+    uint32_t  buckets[LNM_HIST_BUCKETS];
+} LNM_Histogram;
+
+/**
+ * @brief LNM_TelemetryInit Mark LNM_STAGE_INIT.
+ */
+void LNM_TelemetryInit(void);
+
+/**
+ * @brief LNM_TelemetryMark Timestamp a stage and record every latency
+ *        that ends at it.
+ */
+void LNM_TelemetryMark(eLnmStage stage);
+
+/**
+ * @brief LNM_TelemetryHistogram
+ * @return the histogram of latency lat, NULL if out of range
+ */
+const LNM_Histogram *LNM_TelemetryHistogram(eLnmLatency lat);
+
+/**
+ * @brief LNM_TelemetryLatencyName
+ * @return the t2 marker name used for lat
+ */
+const char *LNM_TelemetryLatencyName(eLnmLatency lat);
+
+/**
+ * @brief LNM_TelemetryDump Log a one line summary per latency.
+ */
+void LNM_TelemetryDump(void);
+
+#endif /* _LANMGR_TELEMETRY_H_ */
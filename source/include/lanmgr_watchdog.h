@@ -0,0 +1,70 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef _LANMGR_WATCHDOG_H_
+#define _LANMGR_WATCHDOG_H_
+
+/**
+ * @brief Hung thread detection and the systemd service watchdog.
+ *
+ * Every worker thread registers itself and brackets each unit of work with
+ * LNM_WatchdogBegin()/LNM_WatchdogEnd(). A check on the event loop looks at
+ * all of them: work running past its deadline is logged and counted once as
+ * an overrun, work running past LNM_WD_HANG_MSECS marks the process hung.
+ * With WatchdogSec= set on the service the check runs at half the watchdog
+ * period and sends WATCHDOG=1 only while nothing is hung, so systemd
+ * restarts a wedged lan_manager. Without it the check runs every
+ * LNM_WD_CHECK_MSECS only while some work is in progress: the first work to
+ * begin arms it and it stops once every thread is idle, so an idle daemon
+ * does not wake up and busy work costs no timer per unit. The
+ * notification path needs no heartbeat of its own: it runs on the loop,
+ * and a loop stuck in sysevent_getnotification never gets to send the
+ * keep-alive.
+ */
+#define LNM_WD_MAX_THREADS             8
+#define LNM_WD_DEFAULT_DEADLINE_MSECS  1000
+#define LNM_WD_HANG_MSECS              20000
+#define LNM_WD_CHECK_MSECS             1000    /* without a service watchdog */
+
+/**
+ * @brief LNM_WatchdogRegister Watch the calling thread from now on.
+ * @return 0 on success, -1 if the table is full
+ */
+int LNM_WatchdogRegister(const char *name);
+
+/**
+ * @brief LNM_WatchdogBegin The calling thread starts a unit of work. Does
+ *        nothing on threads that are not registered.
+ * @param[in] what        logged if the work overruns, e.g. the event name
+ * @param[in] deadline_ms 0 for LNM_WD_DEFAULT_DEADLINE_MSECS
+ */
+void LNM_WatchdogBegin(const char *what, unsigned int deadline_ms);
+
+/**
+ * @brief LNM_WatchdogEnd The calling thread finished its unit of work.
+ */
+void LNM_WatchdogEnd(void);
+
+/**
+ * @brief LNM_WatchdogStart Start the periodic check on the event loop if
+ *        the service has a watchdog.
+ * @return 0 on success, -1 if the check could not be scheduled
+ */
+int LNM_WatchdogStart(void);
+
+#endif /* _LANMGR_WATCHDOG_H_ */